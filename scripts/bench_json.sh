@@ -0,0 +1,83 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+# Runs the JSON scanner benchmark from a native build and a scalar-only
+# build, fails when their fuzz digests differ, and prints MB/s for both.
+# With --config-source it also times osd_config_apply_file() on the shipped
+# config and on a copy padded to the 1 MiB loader limit.
+
+bin_source="./build/hyprvolume-json-bench"
+scalar_source="./build/hyprvolume-json-bench-scalar"
+config_source=""
+config_path="./assets/default-config.json"
+fuzz_cases=20000
+megabytes=2
+seed=1
+
+usage() {
+  cat <<'USAGE'
+Usage: scripts/bench_json.sh [options]
+
+  --bin-source <path>      Native build (default: ./build/hyprvolume-json-bench)
+  --scalar-source <path>   Scalar-only build (default: ./build/hyprvolume-json-bench-scalar)
+  --config-source <path>   Config load bench to run afterwards (default: none)
+  --config <path>          Config it times and pads (default: ./assets/default-config.json)
+  --fuzz-cases <count>     Random texts checked against the reference loop (default: 20000)
+  --megabytes <count>      Size of each throughput corpus (default: 2)
+  --seed <value>           Fuzz and corpus seed (default: 1)
+USAGE
+}
+
+while (($# > 0)); do
+  case "$1" in
+    --bin-source | --scalar-source | --config-source | --config | --fuzz-cases | --megabytes | --seed)
+      if (($# < 2)); then
+        echo "Missing value after $1" >&2
+        exit 1
+      fi
+      case "$1" in
+        --bin-source) bin_source="$2" ;;
+        --scalar-source) scalar_source="$2" ;;
+        --config-source) config_source="$2" ;;
+        --config) config_path="$2" ;;
+        --fuzz-cases) fuzz_cases="$2" ;;
+        --megabytes) megabytes="$2" ;;
+        --seed) seed="$2" ;;
+      esac
+      shift 2
+      ;;
+    -h | --help)
+      usage
+      exit 0
+      ;;
+    *)
+      echo "Unknown option: $1" >&2
+      usage >&2
+      exit 1
+      ;;
+  esac
+done
+
+for binary in "$bin_source" "$scalar_source" ${config_source:+"$config_source"}; do
+  if [[ ! -x "$binary" ]]; then
+    echo "JSON benchmark not found: $binary (run make bench-json first)" >&2
+    exit 1
+  fi
+done
+
+native_output="$("$bin_source" --fuzz-cases "$fuzz_cases" --megabytes "$megabytes" --seed "$seed")"
+scalar_output="$("$scalar_source" --fuzz-cases "$fuzz_cases" --megabytes "$megabytes" --seed "$seed")"
+echo "$native_output"
+echo "$scalar_output"
+
+# Each build already matched the reference loop; equal digests show both saw the same offsets
+native_digest="$(grep -o 'fuzz_digest=[0-9a-f]*' <<<"$native_output")"
+scalar_digest="$(grep -o 'fuzz_digest=[0-9a-f]*' <<<"$scalar_output")"
+if [[ -z "$native_digest" || "$native_digest" != "$scalar_digest" ]]; then
+  echo "Native and scalar scanners disagree: ${native_digest:-none} vs ${scalar_digest:-none}" >&2
+  exit 1
+fi
+
+if [[ -n "$config_source" ]]; then
+  "$config_source" --config "$config_path"
+fi
@@ -0,0 +1,126 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+# Drives volume changes through wpctl against a running watcher and reports
+# the frame paint timings from its SIGUSR1 stats line.
+
+bin_source="./hyprvolume"
+config_file="./assets/default-config.json"
+renderer="cairo"
+steps=120
+interval_ms=120
+css_decoration=0
+sink="@DEFAULT_AUDIO_SINK@"
+log_file=""
+css_file=""
+watcher_pid=""
+original_volume=""
+
+cleanup() {
+  if [[ -n "$watcher_pid" ]] && kill -0 "$watcher_pid" 2>/dev/null; then
+    kill "$watcher_pid" 2>/dev/null || true
+    wait "$watcher_pid" 2>/dev/null || true
+  fi
+  if [[ -n "$original_volume" ]]; then
+    wpctl set-volume "$sink" "$original_volume" >/dev/null 2>&1 || true
+  fi
+  if [[ -n "$log_file" && -f "$log_file" ]]; then
+    rm -f "$log_file"
+  fi
+  if [[ -n "$css_file" && -f "$css_file" ]]; then
+    rm -f "$css_file"
+  fi
+}
+trap cleanup EXIT
+
+usage() {
+  cat <<'USAGE'
+Usage: scripts/bench_render.sh [options]
+
+  --bin-source <path>   Binary to benchmark (default: ./hyprvolume)
+  --renderer <name>     GSK_RENDERER value (default: cairo)
+  --steps <count>       Volume changes to apply (default: 120)
+  --interval-ms <ms>    Delay between changes (default: 120)
+  --css-decoration      Load an empty custom sheet so the CSS drawn card and bar are measured
+USAGE
+}
+
+while (($# > 0)); do
+  case "$1" in
+    --bin-source | --renderer | --steps | --interval-ms)
+      if (($# < 2)); then
+        echo "Missing value after $1" >&2
+        exit 1
+      fi
+      case "$1" in
+        --bin-source) bin_source="$2" ;;
+        --renderer) renderer="$2" ;;
+        --steps) steps="$2" ;;
+        --interval-ms) interval_ms="$2" ;;
+      esac
+      shift 2
+      ;;
+    --css-decoration)
+      css_decoration=1
+      shift
+      ;;
+    -h | --help)
+      usage
+      exit 0
+      ;;
+    *)
+      echo "Unknown option: $1" >&2
+      usage >&2
+      exit 1
+      ;;
+  esac
+done
+
+if [[ ! "$steps" =~ ^[0-9]+$ || ! "$interval_ms" =~ ^[0-9]+$ ]]; then
+  echo "--steps and --interval-ms take non-negative integers" >&2
+  exit 1
+fi
+if [[ ! -x "$bin_source" ]]; then
+  echo "Binary not found: $bin_source (run make first)" >&2
+  exit 1
+fi
+if ! command -v wpctl >/dev/null 2>&1; then
+  echo "wpctl is required to drive volume changes" >&2
+  exit 1
+fi
+
+# Restored on exit so the benchmark leaves the sink as it found it.
+original_volume="$(wpctl get-volume "$sink" | awk '{print $2}')"
+log_file="$(mktemp)"
+
+extra_args=()
+if ((css_decoration == 1)); then
+  css_file="$(mktemp --suffix=.css)"
+  echo "/* benchmark: forces CSS drawn decoration */" >"$css_file"
+  extra_args+=(--css-file "$css_file")
+fi
+
+# Each change re-arms the hide timer, so the popup stays visible for the whole run.
+GSK_RENDERER="$renderer" "$bin_source" --config "$config_file" --watch --watch-poll-ms 40 \
+  --timeout-ms 10000 ${extra_args[@]+"${extra_args[@]}"} 2>"$log_file" &
+watcher_pid=$!
+sleep 1
+
+interval_s="$(awk -v ms="$interval_ms" 'BEGIN { printf "%.3f", ms / 1000 }')"
+for ((step = 0; step < steps; step++)); do
+  wpctl set-volume "$sink" "$((30 + (step % 41)))%"
+  sleep "$interval_s"
+done
+
+kill -USR1 "$watcher_pid"
+sleep 0.3
+
+stats_line="$(grep 'hyprvolume stats:' "$log_file" | tail -n 1 || true)"
+if [[ -z "$stats_line" ]]; then
+  echo "Watcher printed no stats line" >&2
+  cat "$log_file" >&2
+  exit 1
+fi
+
+echo "renderer=$renderer steps=$steps css_decoration=$css_decoration"
+tr ' ' '\n' <<<"$stats_line" | grep -E '^(frames_painted|frame_avg_us|frame_max_us)='
@@ -0,0 +1,150 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+# Forces repeated hide/show cycles through wpctl and reports the show latency
+# (show request to first painted frame) from the watcher's SIGUSR1 stats line.
+# Release mode also reports RSS around the teardown and the rebuild time.
+
+bin_source="./hyprvolume"
+config_file="./assets/default-config.json"
+hide_mode="unmap"
+cycles=30
+headless=0
+sink="@DEFAULT_AUDIO_SINK@"
+log_file=""
+compositor_config=""
+compositor_pid=""
+watcher_pid=""
+original_volume=""
+
+cleanup() {
+  if [[ -n "$watcher_pid" ]] && kill -0 "$watcher_pid" 2>/dev/null; then
+    kill "$watcher_pid" 2>/dev/null || true
+    wait "$watcher_pid" 2>/dev/null || true
+  fi
+  if [[ -n "$compositor_pid" ]] && kill -0 "$compositor_pid" 2>/dev/null; then
+    kill "$compositor_pid" 2>/dev/null || true
+    wait "$compositor_pid" 2>/dev/null || true
+  fi
+  if [[ -n "$original_volume" ]]; then
+    wpctl set-volume "$sink" "$original_volume" >/dev/null 2>&1 || true
+  fi
+  if [[ -n "$log_file" && -f "$log_file" ]]; then
+    rm -f "$log_file"
+  fi
+  if [[ -n "$compositor_config" && -f "$compositor_config" ]]; then
+    rm -f "$compositor_config"
+  fi
+}
+trap cleanup EXIT
+
+usage() {
+  cat <<'USAGE'
+Usage: scripts/bench_show.sh [options]
+
+  --bin-source <path>   Binary to benchmark (default: ./hyprvolume)
+  --hide-mode <mode>    unmap, keep-mapped, or release (default: unmap)
+  --cycles <count>      Hide/show cycles to time (default: 30)
+  --headless            Run inside a headless sway instead of the current session
+USAGE
+}
+
+while (($# > 0)); do
+  case "$1" in
+    --bin-source | --hide-mode | --cycles)
+      if (($# < 2)); then
+        echo "Missing value after $1" >&2
+        exit 1
+      fi
+      case "$1" in
+        --bin-source) bin_source="$2" ;;
+        --hide-mode) hide_mode="$2" ;;
+        --cycles) cycles="$2" ;;
+      esac
+      shift 2
+      ;;
+    --headless)
+      headless=1
+      shift
+      ;;
+    -h | --help)
+      usage
+      exit 0
+      ;;
+    *)
+      echo "Unknown option: $1" >&2
+      usage >&2
+      exit 1
+      ;;
+  esac
+done
+
+if [[ ! "$cycles" =~ ^[0-9]+$ ]]; then
+  echo "--cycles takes a non-negative integer" >&2
+  exit 1
+fi
+if [[ ! -x "$bin_source" ]]; then
+  echo "Binary not found: $bin_source (run make first)" >&2
+  exit 1
+fi
+if ! command -v wpctl >/dev/null 2>&1; then
+  echo "wpctl is required to drive volume changes" >&2
+  exit 1
+fi
+
+if ((headless == 1)); then
+  if ! command -v sway >/dev/null 2>&1; then
+    echo "--headless needs sway (wlroots headless backend with layer-shell)" >&2
+    exit 1
+  fi
+  runtime_dir="${XDG_RUNTIME_DIR:-/run/user/$(id -u)}"
+  sockets_before="$(ls "$runtime_dir" 2>/dev/null | grep -E '^wayland-[0-9]+$' || true)"
+  compositor_config="$(mktemp)"
+  # Empty config: one headless output, no bar, no input devices.
+  : >"$compositor_config"
+  WLR_BACKENDS=headless WLR_LIBINPUT_NO_DEVICES=1 WLR_RENDERER=pixman \
+    sway --config "$compositor_config" >/dev/null 2>&1 &
+  compositor_pid=$!
+
+  socket_name=""
+  for _ in $(seq 1 50); do
+    socket_name="$(ls "$runtime_dir" 2>/dev/null | grep -E '^wayland-[0-9]+$' | grep -vxF "$sockets_before" | head -n 1 || true)"
+    if [[ -n "$socket_name" ]]; then
+      break
+    fi
+    sleep 0.1
+  done
+  if [[ -z "$socket_name" ]]; then
+    echo "Headless compositor did not create a Wayland socket" >&2
+    exit 1
+  fi
+  export WAYLAND_DISPLAY="$socket_name"
+fi
+
+original_volume="$(wpctl get-volume "$sink" | awk '{print $2}')"
+log_file="$(mktemp)"
+
+# Shortest timeout so each change lands on a hidden popup.
+"$bin_source" --config "$config_file" --watch --watch-poll-ms 40 --timeout-ms 100 \
+  --hide-mode "$hide_mode" 2>"$log_file" &
+watcher_pid=$!
+sleep 1
+
+# Hidden polling backs off to at most one second, so each cycle waits past it.
+for ((cycle = 0; cycle < cycles; cycle++)); do
+  wpctl set-volume "$sink" "$((30 + (cycle % 2) * 10))%"
+  sleep 1.2
+done
+
+kill -USR1 "$watcher_pid"
+sleep 0.3
+
+stats_line="$(grep 'hyprvolume stats:' "$log_file" | tail -n 1 || true)"
+if [[ -z "$stats_line" ]]; then
+  echo "Watcher printed no stats line" >&2
+  cat "$log_file" >&2
+  exit 1
+fi
+
+echo "hide_mode=$hide_mode cycles=$cycles headless=$headless"
+tr ' ' '\n' <<<"$stats_line" | grep -E '^(popup_shows|shows_painted|show_latency_avg_us|show_latency_max_us|rss_kib|window_releases|release_rss_before_kib|release_rss_after_kib|window_restores|restore_avg_us|restore_max_us)='
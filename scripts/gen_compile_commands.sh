@@ -34,7 +34,7 @@ common_flags=(
   -Wpedantic
 )
 
-mapfile -t src_files < <(find "$repo_root/src" -type f -name '*.c' | sort)
+mapfile -t src_files < <(find "$repo_root/src" "$repo_root/tools" -type f -name '*.c' | sort)
 if [[ ${#src_files[@]} -eq 0 ]]; then
   echo "No C source files found in $repo_root/src" >&2
   exit 1
@@ -0,0 +1,129 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+# Runs the virtual-clock soak driver and prints how counters and process
+# resources moved between the first and the last simulated day.
+
+bin_source="./build/hyprvolume-soak"
+days=7
+seed=1
+hide_mode="unmap"
+headless=0
+log_file=""
+compositor_config=""
+compositor_pid=""
+
+cleanup() {
+  if [[ -n "$compositor_pid" ]] && kill -0 "$compositor_pid" 2>/dev/null; then
+    kill "$compositor_pid" 2>/dev/null || true
+    wait "$compositor_pid" 2>/dev/null || true
+  fi
+  if [[ -n "$log_file" && -f "$log_file" ]]; then
+    rm -f "$log_file"
+  fi
+  if [[ -n "$compositor_config" && -f "$compositor_config" ]]; then
+    rm -f "$compositor_config"
+  fi
+}
+trap cleanup EXIT
+
+usage() {
+  cat <<'USAGE'
+Usage: scripts/soak.sh [options]
+
+  --bin-source <path>   Soak driver to run (default: ./build/hyprvolume-soak)
+  --days <count>        Simulated uptime (default: 7)
+  --seed <value>        Event model seed (default: 1)
+  --hide-mode <mode>    unmap, keep-mapped, or release (default: unmap)
+  --headless            Run inside a headless sway instead of the current session
+USAGE
+}
+
+while (($# > 0)); do
+  case "$1" in
+    --bin-source | --days | --seed | --hide-mode)
+      if (($# < 2)); then
+        echo "Missing value after $1" >&2
+        exit 1
+      fi
+      case "$1" in
+        --bin-source) bin_source="$2" ;;
+        --days) days="$2" ;;
+        --seed) seed="$2" ;;
+        --hide-mode) hide_mode="$2" ;;
+      esac
+      shift 2
+      ;;
+    --headless)
+      headless=1
+      shift
+      ;;
+    -h | --help)
+      usage
+      exit 0
+      ;;
+    *)
+      echo "Unknown option: $1" >&2
+      usage >&2
+      exit 1
+      ;;
+  esac
+done
+
+if [[ ! -x "$bin_source" ]]; then
+  echo "Soak driver not found: $bin_source (run make soak first)" >&2
+  exit 1
+fi
+
+if ((headless == 1)); then
+  if ! command -v sway >/dev/null 2>&1; then
+    echo "--headless needs sway (wlroots headless backend with layer-shell)" >&2
+    exit 1
+  fi
+  runtime_dir="${XDG_RUNTIME_DIR:-/run/user/$(id -u)}"
+  sockets_before="$(ls "$runtime_dir" 2>/dev/null | grep -E '^wayland-[0-9]+$' || true)"
+  compositor_config="$(mktemp)"
+  # Empty config: one headless output, no bar, no input devices.
+  : >"$compositor_config"
+  WLR_BACKENDS=headless WLR_LIBINPUT_NO_DEVICES=1 WLR_RENDERER=pixman \
+    sway --config "$compositor_config" >/dev/null 2>&1 &
+  compositor_pid=$!
+
+  socket_name=""
+  for _ in $(seq 1 50); do
+    socket_name="$(ls "$runtime_dir" 2>/dev/null | grep -E '^wayland-[0-9]+$' | grep -vxF "$sockets_before" | head -n 1 || true)"
+    if [[ -n "$socket_name" ]]; then
+      break
+    fi
+    sleep 0.1
+  done
+  if [[ -z "$socket_name" ]]; then
+    echo "Headless compositor did not create a Wayland socket" >&2
+    exit 1
+  fi
+  export WAYLAND_DISPLAY="$socket_name"
+fi
+
+log_file="$(mktemp)"
+started="$(date +%s)"
+if ! "$bin_source" --days "$days" --seed "$seed" --hide-mode "$hide_mode" 2>"$log_file"; then
+  echo "Soak driver failed" >&2
+  cat "$log_file" >&2
+  exit 1
+fi
+elapsed="$(($(date +%s) - started))"
+
+mapfile -t stats_lines < <(grep 'hyprvolume stats:' "$log_file" || true)
+if ((${#stats_lines[@]} == 0)); then
+  echo "Soak driver printed no stats line" >&2
+  cat "$log_file" >&2
+  exit 1
+fi
+
+keys='^(uptime_ms|watch_polls|watch_timer_arms|hide_timer_arms|popup_shows|popup_hides|query_failures|query_recoveries|max_poll_drift_us|rss_kib|rss_growth_kib|open_fds|fd_growth|zombie_children)='
+echo "days=$days seed=$seed hide_mode=$hide_mode headless=$headless wall_seconds=$elapsed"
+grep 'hyprvolume soak:' "$log_file" || true
+echo "first day:"
+tr ' ' '\n' <<<"${stats_lines[0]}" | grep -E "$keys" | sed 's/^/  /'
+echo "last day:"
+tr ' ' '\n' <<<"${stats_lines[${#stats_lines[@]} - 1]}" | grep -E "$keys" | sed 's/^/  /'
@@ -0,0 +1,138 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+# Runs the geometry sweep driver, which shows every value from 0% to 200%,
+# MUTED, and 0% again in one popup, and fails if the popup window changed
+# size while it was up.
+
+bin_source="./build/hyprvolume-sweep"
+css_path=""
+headless=0
+log_file=""
+compositor_config=""
+compositor_pid=""
+
+cleanup() {
+  if [[ -n "$compositor_pid" ]] && kill -0 "$compositor_pid" 2>/dev/null; then
+    kill "$compositor_pid" 2>/dev/null || true
+    wait "$compositor_pid" 2>/dev/null || true
+  fi
+  if [[ -n "$log_file" && -f "$log_file" ]]; then
+    rm -f "$log_file"
+  fi
+  if [[ -n "$compositor_config" && -f "$compositor_config" ]]; then
+    rm -f "$compositor_config"
+  fi
+}
+trap cleanup EXIT
+
+usage() {
+  cat <<'USAGE'
+Usage: scripts/sweep.sh [options]
+
+  --bin-source <path>   Sweep driver to run (default: ./build/hyprvolume-sweep)
+  --css <path>          Custom stylesheet, which swaps in the CSS drawn widgets
+  --headless            Run inside a headless sway instead of the current session
+USAGE
+}
+
+while (($# > 0)); do
+  case "$1" in
+    --bin-source | --css)
+      if (($# < 2)); then
+        echo "Missing value after $1" >&2
+        exit 1
+      fi
+      case "$1" in
+        --bin-source) bin_source="$2" ;;
+        --css) css_path="$2" ;;
+      esac
+      shift 2
+      ;;
+    --headless)
+      headless=1
+      shift
+      ;;
+    -h | --help)
+      usage
+      exit 0
+      ;;
+    *)
+      echo "Unknown option: $1" >&2
+      usage >&2
+      exit 1
+      ;;
+  esac
+done
+
+if [[ ! -x "$bin_source" ]]; then
+  echo "Sweep driver not found: $bin_source (run make sweep first)" >&2
+  exit 1
+fi
+
+if ((headless == 1)); then
+  if ! command -v sway >/dev/null 2>&1; then
+    echo "--headless needs sway (wlroots headless backend with layer-shell)" >&2
+    exit 1
+  fi
+  runtime_dir="${XDG_RUNTIME_DIR:-/run/user/$(id -u)}"
+  sockets_before="$(ls "$runtime_dir" 2>/dev/null | grep -E '^wayland-[0-9]+$' || true)"
+  compositor_config="$(mktemp)"
+  # Empty config: one headless output, no bar, no input devices.
+  : >"$compositor_config"
+  WLR_BACKENDS=headless WLR_LIBINPUT_NO_DEVICES=1 WLR_RENDERER=pixman \
+    sway --config "$compositor_config" >/dev/null 2>&1 &
+  compositor_pid=$!
+
+  socket_name=""
+  for _ in $(seq 1 50); do
+    socket_name="$(ls "$runtime_dir" 2>/dev/null | grep -E '^wayland-[0-9]+$' | grep -vxF "$sockets_before" | head -n 1 || true)"
+    if [[ -n "$socket_name" ]]; then
+      break
+    fi
+    sleep 0.1
+  done
+  if [[ -z "$socket_name" ]]; then
+    echo "Headless compositor did not create a Wayland socket" >&2
+    exit 1
+  fi
+  export WAYLAND_DISPLAY="$socket_name"
+fi
+
+log_file="$(mktemp)"
+driver_args=()
+if [[ -n "$css_path" ]]; then
+  driver_args+=(--css "$css_path")
+fi
+if ! "$bin_source" "${driver_args[@]}" 2>"$log_file"; then
+  echo "Sweep driver failed" >&2
+  cat "$log_file" >&2
+  exit 1
+fi
+
+stats_line="$(grep 'hyprvolume stats:' "$log_file" | tail -n 1 || true)"
+if [[ -z "$stats_line" ]]; then
+  echo "Sweep driver printed no stats line" >&2
+  cat "$log_file" >&2
+  exit 1
+fi
+
+stat_value() {
+  tr ' ' '\n' <<<"$stats_line" | sed -n "s/^$1=//p"
+}
+
+popup_shows="$(stat_value popup_shows)"
+window_resizes="$(stat_value window_resizes)"
+echo "css=${css_path:-built-in} headless=$headless"
+grep 'hyprvolume sweep:' "$log_file" || true
+tr ' ' '\n' <<<"$stats_line" | grep -E '^(popup_shows|layout_passes|window_resizes|frames_painted)=' | sed 's/^/  /'
+
+# One show keeps every value in the same window, so any size change came from the values themselves
+if [[ "$popup_shows" != "1" ]]; then
+  echo "Expected the popup to stay up for the whole sweep, it was shown $popup_shows times" >&2
+  exit 1
+fi
+if [[ "$window_resizes" != "0" ]]; then
+  echo "Popup window changed size $window_resizes times during the sweep" >&2
+  exit 1
+fi
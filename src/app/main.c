@@ -25,13 +25,54 @@ static bool osd_args_validate_combined(const OSDArgs *args, FILE *err_stream) {
   return true;
 }
 
-/* Application entrypoint: defaults -> parse -> optional config -> window runtime. */
+/* CLI-resolved args and ownership mask kept so config reloads can layer underneath. */
+typedef struct {
+  OSDArgs cli_args;
+  OSDArgsOverrides overrides;
+} OSDAppCommandLine;
+
+/* Applies the config file over CLI-parsed args, then restores CLI-owned settings. */
+static bool osd_app_resolve_config(const OSDAppCommandLine *command_line, OSDArgs *out_args, FILE *err_stream) {
+  OSDArgs args = command_line->cli_args;
+
+  if (!osd_config_apply_file(args.config_path, &args, err_stream)) {
+    return false;
+  }
+
+  osd_args_apply_overrides(&args, &command_line->cli_args, &command_line->overrides);
+  *out_args = args;
+  return true;
+}
+
+/* Re-resolves config -> CLI overrides for watch-mode config reload without touching argv. */
+static bool osd_app_reload_args(OSDArgs *out_args, FILE *err_stream, void *user_data) {
+  const OSDAppCommandLine *command_line = user_data;
+  OSDArgs args;
+
+  if (out_args == NULL || err_stream == NULL || command_line == NULL) {
+    return false;
+  }
+
+  if (!osd_app_resolve_config(command_line, &args, err_stream)) {
+    return false;
+  }
+
+  if (!osd_args_validate_combined(&args, err_stream)) {
+    return false;
+  }
+
+  *out_args = args;
+  return true;
+}
+
+/* Application entrypoint: defaults -> parse -> optional config -> CLI overrides -> window runtime. */
 int main(int argc, char **argv) {
+  static OSDAppCommandLine command_line;
   OSDArgs args;
 
   osd_args_defaults(&args);
 
-  if (!osd_args_parse(argc, argv, &args, stderr)) {
+  if (!osd_args_parse(argc, argv, &args, &command_line.overrides, stderr)) {
     osd_args_print_help(stderr, (argc > 0) ? argv[0] : "hyprvolume");
     return EXIT_FAILURE;
   }
@@ -42,19 +83,11 @@ int main(int argc, char **argv) {
   }
 
   if (args.config_path_set) {
-    if (!osd_config_apply_file(args.config_path, &args, stderr)) {
-      return EXIT_FAILURE;
-    }
-
-    if (!osd_args_parse(argc, argv, &args, stderr)) {
-      osd_args_print_help(stderr, (argc > 0) ? argv[0] : "hyprvolume");
+    /* Config sees CLI values first so cross-key checks match the merged result. */
+    command_line.cli_args = args;
+    if (!osd_app_resolve_config(&command_line, &args, stderr)) {
       return EXIT_FAILURE;
     }
-
-    if (args.show_help) {
-      osd_args_print_help(stdout, (argc > 0) ? argv[0] : "hyprvolume");
-      return EXIT_SUCCESS;
-    }
   }
 
   if (!osd_args_validate_combined(&args, stderr)) {
@@ -62,5 +95,5 @@ int main(int argc, char **argv) {
     return EXIT_FAILURE;
   }
 
-  return osd_window_run(&args);
+  return osd_window_run(&args, args.config_path_set ? osd_app_reload_args : NULL, &command_line);
 }
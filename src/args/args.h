@@ -2,10 +2,13 @@
 #define HYPRVOLUME_ARGS_H
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 
 /* Upper bound for --config path and config_path JSON field. */
 #define OSD_CONFIG_PATH_MAX 4096U
+/* Upper bound for monitor indices listed in one monitor_index value. */
+#define OSD_MONITOR_LIST_MAX 8U
 
 /* Runtime volume sample shown in the popup. */
 typedef struct {
@@ -23,6 +26,27 @@ typedef enum {
     OSD_ANCHOR_BOTTOM_RIGHT = 5
 } OSDAnchor;
 
+/* What watch mode does with the popup surface between shows. */
+typedef enum {
+    /* Unmap the layer surface, every show maps and configures it again. */
+    OSD_HIDE_MODE_UNMAP = 0,
+    /* Keep the surface mapped with transparent content, a show is one frame. */
+    OSD_HIDE_MODE_KEEP_MAPPED = 1,
+    /* Destroy the window and trim the heap, a show rebuilds everything. */
+    OSD_HIDE_MODE_RELEASE = 2
+} OSDHideMode;
+
+/* Monitors that show the popup, a single -1 entry keeps the default monitor. */
+typedef struct {
+    /* Every connected monitor, the index list is unused. */
+    bool all;
+    /* The monitor Hyprland reports as focused, followed at show time; the index list is unused. */
+    bool focused;
+    /* Listed 0-based indices in config order, at least one unless all is set. */
+    unsigned int count;
+    int indices[OSD_MONITOR_LIST_MAX];
+} OSDMonitorSelection;
+
 /* Theme values are interpreted as pixels or CSS values unless noted. */
 typedef struct {
     unsigned int width_px;
@@ -35,6 +59,8 @@ typedef struct {
     OSDAnchor anchor;
     unsigned int corner_radius_px;
     unsigned int icon_size_px;
+    /* Use the desktop icon theme instead of the bundled icons. */
+    bool system_icons;
     unsigned int font_size_px;
     char background_color[128];
     char border_color[96];
@@ -49,7 +75,9 @@ typedef struct {
     OSDVolumeState volume;
     unsigned int timeout_ms;
     unsigned int watch_poll_ms;
-    int monitor_index;
+    OSDHideMode hide_mode;
+    bool suppress_fullscreen;
+    OSDMonitorSelection monitors;
     char config_path[OSD_CONFIG_PATH_MAX];
     bool config_path_set;
     char css_path[OSD_CONFIG_PATH_MAX];
@@ -61,11 +89,20 @@ typedef struct {
     OSDTheme theme;
 } OSDArgs;
 
+/* Settings explicitly given on the command line, one bit per schema setting id. */
+typedef struct {
+    uint64_t set_mask;
+} OSDArgsOverrides;
+
 void osd_args_defaults(OSDArgs *args);
 
-// Parses CLI flags into out
+// Parses CLI flags into out and records which settings they touched
+// out_overrides may be null when the caller never layers config underneath
 // Returns false when input is invalid
-bool osd_args_parse(int argc, char **argv, OSDArgs *out, FILE *err_stream);
+bool osd_args_parse(int argc, char **argv, OSDArgs *out, OSDArgsOverrides *out_overrides, FILE *err_stream);
+
+// Copies every CLI-set setting from cli_args over target so CLI wins over config
+void osd_args_apply_overrides(OSDArgs *target, const OSDArgs *cli_args, const OSDArgsOverrides *overrides);
 
 // Prints CLI help text
 void osd_args_print_help(FILE *out_stream, const char *program_name);
@@ -34,7 +34,12 @@ void osd_args_defaults(OSDArgs *args) {
     args->volume.muted = false;
     args->timeout_ms = OSD_DEFAULT_TIMEOUT_MS;
     args->watch_poll_ms = OSD_DEFAULT_WATCH_POLL_MS;
-    args->monitor_index = -1;
+    args->hide_mode = OSD_HIDE_MODE_UNMAP;
+    args->suppress_fullscreen = false;
+    args->monitors.all = false;
+    args->monitors.focused = false;
+    args->monitors.count = 1U;
+    args->monitors.indices[0] = -1;
     args->config_path[0] = '\0';
     args->config_path_set = false;
     args->css_path[0] = '\0';
@@ -54,6 +59,7 @@ void osd_args_defaults(OSDArgs *args) {
     args->theme.anchor = OSD_ANCHOR_TOP_CENTER;
     args->theme.corner_radius_px = OSD_DEFAULT_CORNER_RADIUS_PX;
     args->theme.icon_size_px = OSD_DEFAULT_ICON_SIZE_PX;
+    args->theme.system_icons = false;
     args->theme.font_size_px = OSD_DEFAULT_FONT_SIZE_PX;
 
     /*
@@ -1,9 +1,62 @@
 #include "args/args.h"
+#include "args/schema.h"
 #include "common/safeio.h"
 
-/* Prints command usage and all supported runtime options. */
+#include <string.h>
+
+static const char *const OSD_HELP_SECTION_TITLES[OSD_HELP_SECTION_COUNT] = {
+    "Volume source options:",
+    "Behavior options:",
+    "Theme options:",
+    "General:"
+};
+
+/* Description column per section, counted from the two-space indent. */
+static const size_t OSD_HELP_SECTION_TOKEN_WIDTHS[OSD_HELP_SECTION_COUNT] = {23U, 26U, 26U, 23U};
+
+/* Writes "<min-max>" straight from the schema range so help never drifts from validation. */
+static size_t osd_args_help_write_range(FILE *out_stream, const OSDSettingDesc *setting) {
+    char range_text[48];
+    int written = snprintf(range_text, sizeof(range_text), "<%lld-%lld>", setting->min_value, setting->max_value);
+
+    if (written <= 0 || (size_t)written >= sizeof(range_text)) {
+        return 0U;
+    }
+    (void)osd_io_write_text(out_stream, range_text);
+    return (size_t)written;
+}
+
+/* Writes one option line with an aligned description when present. */
+static void osd_args_help_write_option(FILE *out_stream, const OSDCliOptionDesc *option) {
+    size_t token_width = strlen(option->name);
+
+    (void)osd_io_write_text(out_stream, "  ");
+    (void)osd_io_write_text(out_stream, option->name);
+    if (option->metavar == NULL) {
+        (void)osd_io_write_text(out_stream, " ");
+        token_width += 1U + osd_args_help_write_range(out_stream, osd_schema_setting(option->setting));
+    } else if (option->metavar[0] != '\0') {
+        (void)osd_io_write_text(out_stream, " ");
+        (void)osd_io_write_text(out_stream, option->metavar);
+        token_width += 1U + strlen(option->metavar);
+    }
+
+    if (option->help[0] != '\0') {
+        /* Overlong tokens still get one separating space. */
+        do {
+            (void)osd_io_write_text(out_stream, " ");
+            token_width++;
+        } while (token_width < OSD_HELP_SECTION_TOKEN_WIDTHS[option->section]);
+        (void)osd_io_write_text(out_stream, option->help);
+    }
+    (void)osd_io_write_line(out_stream, "");
+}
+
+/* Prints command usage and all supported runtime options from the shared schema. */
 void osd_args_print_help(FILE *out_stream, const char *program_name) {
     const char *name = (program_name == NULL || *program_name == '\0') ? "hyprvolume" : program_name;
+    const OSDCliOptionDesc *options = NULL;
+    size_t option_count = 0U;
 
     if (out_stream == NULL) {
         return;
@@ -12,44 +65,17 @@ void osd_args_print_help(FILE *out_stream, const char *program_name) {
     (void)osd_io_write_text(out_stream, "Usage: ");
     (void)osd_io_write_text(out_stream, name);
     (void)osd_io_write_line(out_stream, " [options]");
-    (void)osd_io_write_text(
-        out_stream,
-        "\n"
-        "Volume source options:\n"
-        "  --from-system          Read current sink volume from wpctl (default).\n"
-        "  --no-system            Use manual values from --value/--muted.\n"
-        "  --value <0-200>        Manual volume percentage.\n"
-        "  --muted                Manual muted state.\n"
-        "  --unmuted              Manual unmuted state.\n"
-        "  --watch                Poll system volume and show OSD when it changes.\n"
-        "  --no-watch             Force single-popup mode even if config enables watch mode.\n"
-        "\n"
-        "Behavior options:\n"
-        "  --timeout-ms <100-10000>  Auto-hide delay in milliseconds (default: 1400).\n"
-        "  --watch-poll-ms <40-2000> Poll interval in watch mode (default: 120).\n"
-        "  --monitor <index>         Target monitor index (0-based, -1 = default).\n"
-        "  --config <path>           Load JSON config file before applying CLI overrides.\n"
-        "  --css-file <path>         Load custom GTK CSS file.\n"
-        "  --css-replace             Use only custom CSS (skip built-in theme CSS).\n"
-        "  --css-append              Keep built-in CSS and append custom CSS overrides.\n"
-        "  --vertical                Use vertical OSD layout.\n"
-        "  --horizontal              Use horizontal OSD layout.\n"
-        "\n"
-        "Theme options:\n"
-        "  --width <40-1400>\n"
-        "  --height <20-300>\n"
-        "  --margin-top <0-500>      Vertical offset for top/bottom anchors.\n"
-        "  --radius <0-200>\n"
-        "  --icon-size <8-200>\n"
-        "  --font-size <8-200>\n"
-        "  --background-color <css-color>\n"
-        "  --border-color <css-color>\n"
-        "  --fill-color <css-color>\n"
-        "  --track-color <css-color>\n"
-        "  --text-color <css-color>\n"
-        "  --icon-color <css-color>\n"
-        "\n"
-        "General:\n"
-        "  --help                 Show this help text.\n"
-    );
+
+    options = osd_schema_cli_options(&option_count);
+    for (unsigned int section = 0U; section < (unsigned int)OSD_HELP_SECTION_COUNT; section++) {
+        (void)osd_io_write_line(out_stream, "");
+        (void)osd_io_write_line(out_stream, OSD_HELP_SECTION_TITLES[section]);
+        for (size_t option_index = 0U; option_index < option_count; option_index++) {
+            /* Aliases carry no help text and stay out of the listing. */
+            if ((unsigned int)options[option_index].section != section || options[option_index].help == NULL) {
+                continue;
+            }
+            osd_args_help_write_option(out_stream, &options[option_index]);
+        }
+    }
 }
@@ -0,0 +1,213 @@
+#include "args/parse/parse_internal.h"
+
+#include "args/parse/parse_option.h"
+#include "args/parse/parse_text.h"
+#include "args/parse/parse_value.h"
+#include "args/schema.h"
+#include "common/safeio.h"
+
+#include <string.h>
+
+// Records one setting as CLI-owned
+static void mark_override(OSDArgsOverrides *overrides, OSDSettingId id) {
+    overrides->set_mask |= (uint64_t)1U << (unsigned int)id;
+}
+
+// Value extraction policy follows the setting grammar
+static OSDOptionValuePolicy policy_for_kind(OSDSettingKind kind) {
+    switch (kind) {
+    case OSD_SETTING_KIND_UINT:
+        return OSD_VALUE_POLICY_NUMERIC_UNSIGNED;
+    // Signed options allow -N such as --monitor -1
+    case OSD_SETTING_KIND_INT:
+    case OSD_SETTING_KIND_MONITORS:
+        return OSD_VALUE_POLICY_NUMERIC_SIGNED;
+    default:
+        return OSD_VALUE_POLICY_TEXT_STRICT;
+    }
+}
+
+// Writes "Value for <name> <detail>" style messages without formatting directives
+static void write_option_message(FILE *err_stream, const char *option_name, const char *detail) {
+    (void)osd_io_write_text(err_stream, "Value for ");
+    (void)osd_io_write_text(err_stream, option_name);
+    (void)osd_io_write_line(err_stream, detail);
+}
+
+// Shared bounded text setter for CSS color values
+static bool bind_text_value(
+    char *target,
+    size_t target_size,
+    const char *option_name,
+    const char *value_text,
+    FILE *err_stream
+) {
+    // Reject empty and overflow cases before mutating destination
+    if (value_text[0] == '\0' || !osd_args_copy_text_bounded(target, target_size, value_text)) {
+        (void)osd_io_write_text(err_stream, "Invalid value for ");
+        (void)osd_io_write_text(err_stream, option_name);
+        (void)osd_io_write_text(err_stream, ": '");
+        (void)osd_io_write_text(err_stream, value_text);
+        (void)osd_io_write_line(err_stream, "'");
+        return false;
+    }
+
+    return true;
+}
+
+// Keyword setter for --hide-mode
+static bool bind_hide_mode_value(
+    OSDHideMode *target,
+    const char *option_name,
+    const char *value_text,
+    FILE *err_stream
+) {
+    if (!osd_schema_parse_hide_mode(value_text, target)) {
+        (void)osd_io_write_text(err_stream, "Invalid value for ");
+        (void)osd_io_write_text(err_stream, option_name);
+        (void)osd_io_write_text(err_stream, ": '");
+        (void)osd_io_write_text(err_stream, value_text);
+        (void)osd_io_write_line(err_stream, "' (expected unmap, keep-mapped, or release)");
+        return false;
+    }
+
+    return true;
+}
+
+// Index, list, or keyword setter for --monitor
+static bool bind_monitors_value(
+    OSDMonitorSelection *target,
+    const char *option_name,
+    const char *value_text,
+    FILE *err_stream
+) {
+    if (!osd_schema_parse_monitors(value_text, target)) {
+        (void)osd_io_write_text(err_stream, "Invalid value for ");
+        (void)osd_io_write_text(err_stream, option_name);
+        (void)osd_io_write_text(err_stream, ": '");
+        (void)osd_io_write_text(err_stream, value_text);
+        (void)osd_io_write_line(err_stream, "' (expected -1, an index, a list like 0,2, all, or focused)");
+        return false;
+    }
+
+    return true;
+}
+
+// Bounded path setter; min_value of the setting is the minimum accepted length
+static bool bind_path_value(
+    OSDArgs *out,
+    const OSDSettingDesc *setting,
+    const char *option_name,
+    const char *value_text,
+    FILE *err_stream
+) {
+    // Empty --config is allowed so the loader can report the real file error
+    if (setting->min_value > 0 && value_text[0] == '\0') {
+        write_option_message(err_stream, option_name, " cannot be empty");
+        return false;
+    }
+
+    // Bounded copy prevents path overflow into fixed runtime buffers
+    if (!osd_args_copy_text_bounded(osd_schema_field(out, setting), setting->size, value_text)) {
+        write_option_message(err_stream, option_name, " is too long");
+        return false;
+    }
+
+    *osd_schema_set_flag(out, setting) = true;
+    return true;
+}
+
+// Parses value_text by setting kind into its OSDArgs field
+static bool bind_value(OSDArgs *out, const OSDSettingDesc *setting, const char *option_name, const char *value_text,
+                       FILE *err_stream) {
+    switch (setting->kind) {
+    case OSD_SETTING_KIND_UINT:
+        return osd_args_parse_ranged_uint(
+            option_name,
+            value_text,
+            (unsigned int)setting->min_value,
+            (unsigned int)setting->max_value,
+            osd_schema_field(out, setting),
+            err_stream
+        );
+    case OSD_SETTING_KIND_INT:
+        return osd_args_parse_ranged_int(
+            option_name,
+            value_text,
+            (int)setting->min_value,
+            (int)setting->max_value,
+            osd_schema_field(out, setting),
+            err_stream
+        );
+    case OSD_SETTING_KIND_TEXT:
+        return bind_text_value(osd_schema_field(out, setting), setting->size, option_name, value_text, err_stream);
+    case OSD_SETTING_KIND_PATH:
+        return bind_path_value(out, setting, option_name, value_text, err_stream);
+    case OSD_SETTING_KIND_HIDE_MODE:
+        return bind_hide_mode_value(osd_schema_field(out, setting), option_name, value_text, err_stream);
+    case OSD_SETTING_KIND_MONITORS:
+        return bind_monitors_value(osd_schema_field(out, setting), option_name, value_text, err_stream);
+    default:
+        // Remaining kinds have no CLI value grammar
+        return false;
+    }
+}
+
+OSDParseDispatch osd_args_bind_cli_option(
+    int argc,
+    char **argv,
+    int *index,
+    const char *arg,
+    OSDArgs *out,
+    OSDArgsOverrides *overrides,
+    FILE *err_stream
+) {
+    const OSDCliOptionDesc *option = NULL;
+    const OSDSettingDesc *setting = NULL;
+    const char *inline_value = NULL;
+    const char *value_text = NULL;
+    const char *equals = strchr(arg, '=');
+    size_t name_len = (equals != NULL) ? (size_t)(equals - arg) : strlen(arg);
+
+    // One hash probe replaces the per-table strcmp chains
+    option = osd_schema_find_cli_option(arg, name_len);
+    if (option == NULL) {
+        return OSD_PARSE_NOT_MATCHED;
+    }
+    setting = osd_schema_setting(option->setting);
+
+    if (option->action != OSD_CLI_VALUE) {
+        // Flags match exactly so --watch=1 stays an unknown option
+        if (equals != NULL) {
+            return OSD_PARSE_NOT_MATCHED;
+        }
+        *(bool *)osd_schema_field(out, setting) = (option->action == OSD_CLI_SET_TRUE);
+    } else {
+        inline_value = (equals != NULL) ? equals + 1 : NULL;
+        // Value extraction controls argv index advances in one place
+        if (!osd_args_extract_option_value(
+                argc,
+                argv,
+                index,
+                option->name,
+                inline_value,
+                policy_for_kind(setting->kind),
+                &value_text,
+                err_stream
+            )) {
+            return OSD_PARSE_ERROR;
+        }
+        if (!bind_value(out, setting, option->name, value_text, err_stream)) {
+            return OSD_PARSE_ERROR;
+        }
+    }
+    mark_override(overrides, option->setting);
+
+    if (option->side_setting != OSD_SETTING_NONE) {
+        // Secondary effects such as --watch implying system volume reads
+        *(bool *)osd_schema_field(out, osd_schema_setting(option->side_setting)) = option->side_value;
+        mark_override(overrides, option->side_setting);
+    }
+
+    return OSD_PARSE_MATCHED;
+}
@@ -13,92 +13,15 @@ typedef enum {
     OSD_PARSE_ERROR = 2
 } OSDParseDispatch;
 
-// Unsigned numeric option descriptor used by generic dispatch loop
-typedef struct {
-    const char *name;
-    unsigned int min_value;
-    unsigned int max_value;
-    unsigned int *target;
-} OSDUIntOption;
-
-// Signed numeric option descriptor used by generic dispatch loop
-typedef struct {
-    const char *name;
-    int min_value;
-    int max_value;
-    int *target;
-} OSDIntOption;
-
-// Text option descriptor for color-like CSS values
-typedef struct {
-    const char *name;
-    char *target;
-    size_t target_size;
-} OSDColorOption;
-
-// Parses uint option tables with shared argv matching and extraction rules
-OSDParseDispatch osd_args_parse_uint_options(
-    int argc,
-    char **argv,
-    int *index,
-    const char *arg,
-    const OSDUIntOption *options,
-    size_t option_count,
-    FILE *err_stream
-);
-
-// Parses int option tables with shared argv matching and extraction rules
-OSDParseDispatch osd_args_parse_int_options(
-    int argc,
-    char **argv,
-    int *index,
-    const char *arg,
-    const OSDIntOption *options,
-    size_t option_count,
-    FILE *err_stream
-);
-
-// Parses text option tables and copies validated values into fixed buffers
-OSDParseDispatch osd_args_parse_color_options(
-    int argc,
-    char **argv,
-    int *index,
-    const char *arg,
-    const OSDColorOption *options,
-    size_t option_count,
-    FILE *err_stream
-);
-
-// Parses --config path and marks config_path_set on success
-OSDParseDispatch osd_args_parse_config_option(
-    int argc,
-    char **argv,
-    int *index,
-    const char *arg,
-    OSDArgs *out,
-    FILE *err_stream
-);
-
-// Parses --css-file path and marks css_path_set on success
-OSDParseDispatch osd_args_parse_css_file_option(
-    int argc,
-    char **argv,
-    int *index,
-    const char *arg,
-    OSDArgs *out,
-    FILE *err_stream
-);
-
-// Parses flag-style toggles that do not require value extraction
-OSDParseDispatch osd_args_parse_toggle_flags(const char *arg, OSDArgs *out);
-
-// Parses --value and switches runtime source to manual mode
-OSDParseDispatch osd_args_parse_value_option(
+// Resolves arg through the schema CLI table and binds its value into out
+// Marks every touched setting in overrides so config loading can layer underneath
+OSDParseDispatch osd_args_bind_cli_option(
     int argc,
     char **argv,
     int *index,
     const char *arg,
     OSDArgs *out,
+    OSDArgsOverrides *overrides,
     FILE *err_stream
 );
 
@@ -0,0 +1,347 @@
+#include "args/schema.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Slot count for both perfect-hash tables, a power of two above twice the key count
+#define OSD_SCHEMA_HASH_SLOTS 128U
+#define OSD_SCHEMA_HASH_SHIFT 25U
+#define OSD_FNV32_OFFSET_BASIS 2166136261U
+#define OSD_FNV32_PRIME 16777619U
+// Seeds pinned for the current tables, make check fails when a schema edit makes one collide
+#define OSD_SCHEMA_CLI_SEED 255U
+#define OSD_SCHEMA_JSON_SEED 34U
+// Seeds tried before giving up, a table at most half full settles within a few hundred
+#define OSD_SCHEMA_SEED_SEARCH_LIMIT 65536U
+
+#define OSD_SETTING_DESC_ENTRY(id, json_key, kind, min, max, field) {json_key, kind, min, max, field},
+static const OSDSettingDesc OSD_SETTING_TABLE[OSD_SETTING_COUNT] = {OSD_SETTINGS(OSD_SETTING_DESC_ENTRY)};
+#undef OSD_SETTING_DESC_ENTRY
+
+#define OSD_CLI_DESC_ENTRY(name, setting, action, side_setting, side_value, section, metavar, help) \
+    {name, OSD_SETTING_##setting, action, OSD_SETTING_##side_setting, side_value, OSD_HELP_SECTION_##section, metavar, help},
+static const OSDCliOptionDesc OSD_CLI_TABLE[] = {OSD_CLI_OPTIONS(OSD_CLI_DESC_ENTRY)};
+#undef OSD_CLI_DESC_ENTRY
+
+#define OSD_CLI_OPTION_COUNT (sizeof(OSD_CLI_TABLE) / sizeof(OSD_CLI_TABLE[0]))
+
+_Static_assert(OSD_CLI_OPTION_COUNT < 255U, "CLI table exceeds slot index width");
+_Static_assert(OSD_SETTING_COUNT < 255U, "setting table exceeds slot index width");
+_Static_assert(OSD_CLI_OPTION_COUNT * 2U <= OSD_SCHEMA_HASH_SLOTS, "CLI table needs more hash slots");
+_Static_assert(OSD_SETTING_COUNT * 2U <= OSD_SCHEMA_HASH_SLOTS, "setting table needs more hash slots");
+
+// Seeded perfect-hash table mapping slot to row index + 1, zero marks empty
+typedef struct {
+    bool built;
+    uint32_t seed;
+    uint8_t slots[OSD_SCHEMA_HASH_SLOTS];
+} OSDSchemaHashTable;
+
+static OSDSchemaHashTable g_cli_hash;
+static OSDSchemaHashTable g_json_hash;
+
+// Seeded FNV-1a over an explicit length so "--name=value" needs no copy
+static uint32_t osd_schema_hash(uint32_t seed, const char *text, size_t length) {
+    uint32_t hash = OSD_FNV32_OFFSET_BASIS ^ (seed * 0x9e3779b9U);
+
+    for (size_t index = 0U; index < length; index++) {
+        hash ^= (uint32_t)(unsigned char)text[index];
+        hash *= OSD_FNV32_PRIME;
+    }
+    // High bits mix best in FNV
+    return hash >> OSD_SCHEMA_HASH_SHIFT;
+}
+
+// Returns the key of row index, or NULL when the row has no key in this namespace
+typedef const char *(*OSDSchemaKeyAtFn)(size_t row_index);
+
+static const char *osd_schema_cli_key_at(size_t row_index) {
+    return OSD_CLI_TABLE[row_index].name;
+}
+
+static const char *osd_schema_json_key_at(size_t row_index) {
+    return OSD_SETTING_TABLE[row_index].json_key;
+}
+
+// Places every key of the table under seed, false when two keys share a slot
+static bool osd_schema_fill_slots(
+    OSDSchemaHashTable *table,
+    uint32_t seed,
+    OSDSchemaKeyAtFn key_at,
+    size_t row_count
+) {
+    memset(table->slots, 0, sizeof(table->slots));
+    for (size_t row_index = 0U; row_index < row_count; row_index++) {
+        const char *key = key_at(row_index);
+        uint32_t slot = 0U;
+
+        if (key == NULL) {
+            continue;
+        }
+        slot = osd_schema_hash(seed, key, strlen(key));
+        if (table->slots[slot] != 0U) {
+            return false;
+        }
+        table->slots[slot] = (uint8_t)(row_index + 1U);
+    }
+    table->seed = seed;
+    return true;
+}
+
+// Walks seeds from first until one fills the table, false when none does within the search limit
+static bool osd_schema_search_seed(
+    OSDSchemaHashTable *table,
+    uint32_t first,
+    OSDSchemaKeyAtFn key_at,
+    size_t row_count
+) {
+    for (uint32_t tries = 0U; tries < OSD_SCHEMA_SEED_SEARCH_LIMIT; tries++) {
+        if (osd_schema_fill_slots(table, first + tries, key_at, row_count)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Builds the table from its pinned seed, which is a single pass for the tables make check accepts
+static void osd_schema_build_hash(
+    OSDSchemaHashTable *table,
+    const char *table_name,
+    uint32_t seed,
+    OSDSchemaKeyAtFn key_at,
+    size_t row_count
+) {
+    if (!osd_schema_fill_slots(table, seed, key_at, row_count)) {
+        // A stale pin still yields a working table, but every process pays the search until it is updated
+        if (!osd_schema_search_seed(table, seed + 1U, key_at, row_count)) {
+            fprintf(
+                stderr,
+                "No collision-free %s hash seed within %u tries; raise OSD_SCHEMA_HASH_SLOTS\n",
+                table_name,
+                OSD_SCHEMA_SEED_SEARCH_LIMIT
+            );
+            abort();
+        }
+        fprintf(
+            stderr,
+            "%s hash seed %u collides; searched to %u, pin it in schema.c\n",
+            table_name,
+            seed,
+            table->seed
+        );
+    }
+    table->built = true;
+}
+
+// One hash, one slot read, and one compare resolve any key
+static size_t osd_schema_hash_find(
+    OSDSchemaHashTable *table,
+    const char *table_name,
+    uint32_t seed,
+    OSDSchemaKeyAtFn key_at,
+    size_t row_count,
+    const char *key,
+    size_t key_length
+) {
+    const char *candidate = NULL;
+    size_t row_index = 0U;
+    uint8_t slot_value = 0U;
+
+    if (!table->built) {
+        osd_schema_build_hash(table, table_name, seed, key_at, row_count);
+    }
+
+    slot_value = table->slots[osd_schema_hash(table->seed, key, key_length)];
+    if (slot_value == 0U) {
+        return row_count;
+    }
+
+    row_index = (size_t)slot_value - 1U;
+    candidate = key_at(row_index);
+    // Slot hit still needs a full compare since unknown keys may share a slot
+    if (strncmp(candidate, key, key_length) != 0 || candidate[key_length] != '\0') {
+        return row_count;
+    }
+    return row_index;
+}
+
+const OSDSettingDesc *osd_schema_setting(OSDSettingId id) {
+    if ((size_t)id >= (size_t)OSD_SETTING_COUNT) {
+        return NULL;
+    }
+    return &OSD_SETTING_TABLE[id];
+}
+
+const OSDCliOptionDesc *osd_schema_cli_options(size_t *out_count) {
+    if (out_count != NULL) {
+        *out_count = OSD_CLI_OPTION_COUNT;
+    }
+    return OSD_CLI_TABLE;
+}
+
+const OSDCliOptionDesc *osd_schema_find_cli_option(const char *name, size_t name_len) {
+    size_t row_index = 0U;
+
+    if (name == NULL) {
+        return NULL;
+    }
+
+    row_index = osd_schema_hash_find(
+        &g_cli_hash, "CLI", OSD_SCHEMA_CLI_SEED, osd_schema_cli_key_at, OSD_CLI_OPTION_COUNT, name, name_len
+    );
+    return (row_index < OSD_CLI_OPTION_COUNT) ? &OSD_CLI_TABLE[row_index] : NULL;
+}
+
+OSDSettingId osd_schema_find_json_key(const char *key) {
+    size_t row_index = 0U;
+
+    if (key == NULL) {
+        return OSD_SETTING_NONE;
+    }
+
+    row_index = osd_schema_hash_find(
+        &g_json_hash, "JSON", OSD_SCHEMA_JSON_SEED, osd_schema_json_key_at, OSD_SETTING_COUNT, key, strlen(key)
+    );
+    return (row_index < OSD_SETTING_COUNT) ? (OSDSettingId)row_index : OSD_SETTING_NONE;
+}
+
+// Reports a pinned seed that no longer fills its table, along with the first seed that does
+static bool osd_schema_check_seed(
+    const char *table_name,
+    uint32_t seed,
+    OSDSchemaKeyAtFn key_at,
+    size_t row_count,
+    FILE *err_stream
+) {
+    OSDSchemaHashTable table;
+
+    if (osd_schema_fill_slots(&table, seed, key_at, row_count)) {
+        return true;
+    }
+    if (osd_schema_search_seed(&table, 0U, key_at, row_count)) {
+        fprintf(err_stream, "%s hash seed %u collides; pin %u in schema.c\n", table_name, seed, table.seed);
+    } else {
+        fprintf(
+            err_stream,
+            "No collision-free %s hash seed within %u tries; raise OSD_SCHEMA_HASH_SLOTS\n",
+            table_name,
+            OSD_SCHEMA_SEED_SEARCH_LIMIT
+        );
+    }
+    return false;
+}
+
+bool osd_schema_check_hash_seeds(FILE *err_stream) {
+    const bool cli_ok =
+        osd_schema_check_seed("CLI", OSD_SCHEMA_CLI_SEED, osd_schema_cli_key_at, OSD_CLI_OPTION_COUNT, err_stream);
+    const bool json_ok =
+        osd_schema_check_seed("JSON", OSD_SCHEMA_JSON_SEED, osd_schema_json_key_at, OSD_SETTING_COUNT, err_stream);
+
+    return cli_ok && json_ok;
+}
+
+void *osd_schema_field(OSDArgs *args, const OSDSettingDesc *setting) {
+    if (args == NULL || setting == NULL || setting->size == 0U) {
+        return NULL;
+    }
+    return (unsigned char *)args + setting->offset;
+}
+
+bool *osd_schema_set_flag(OSDArgs *args, const OSDSettingDesc *setting) {
+    if (args == NULL || setting == NULL || setting->kind != OSD_SETTING_KIND_PATH) {
+        return NULL;
+    }
+    return (bool *)(void *)((unsigned char *)args + setting->set_flag_offset);
+}
+
+// Keyword spelling shared by --hide-mode and the hide_mode JSON key
+typedef struct {
+    const char *keyword;
+    OSDHideMode mode;
+} OSDHideModeName;
+
+static const OSDHideModeName OSD_HIDE_MODE_NAMES[] = {
+    {"unmap", OSD_HIDE_MODE_UNMAP},
+    {"keep-mapped", OSD_HIDE_MODE_KEEP_MAPPED},
+    {"release", OSD_HIDE_MODE_RELEASE},
+};
+
+bool osd_schema_parse_hide_mode(const char *text, OSDHideMode *out_mode) {
+    if (text == NULL || out_mode == NULL) {
+        return false;
+    }
+
+    for (size_t index = 0U; index < sizeof(OSD_HIDE_MODE_NAMES) / sizeof(OSD_HIDE_MODE_NAMES[0]); index++) {
+        if (strcmp(text, OSD_HIDE_MODE_NAMES[index].keyword) == 0) {
+            *out_mode = OSD_HIDE_MODE_NAMES[index].mode;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool osd_schema_append_monitor(OSDMonitorSelection *selection, long index) {
+    const OSDSettingDesc *setting = &OSD_SETTING_TABLE[OSD_SETTING_MONITOR_INDEX];
+
+    if (selection == NULL || selection->count >= OSD_MONITOR_LIST_MAX) {
+        return false;
+    }
+    if ((long long)index < setting->min_value || (long long)index > setting->max_value) {
+        return false;
+    }
+    // -1 names the default monitor and only makes sense on its own
+    if (selection->count > 0U && (index < 0L || selection->indices[0] < 0)) {
+        return false;
+    }
+    for (unsigned int position = 0U; position < selection->count; position++) {
+        if (selection->indices[position] == (int)index) {
+            return false;
+        }
+    }
+
+    selection->indices[selection->count] = (int)index;
+    selection->count++;
+    return true;
+}
+
+// Spelling shared by --monitor and the monitor_index JSON key
+bool osd_schema_parse_monitors(const char *text, OSDMonitorSelection *out_selection) {
+    OSDMonitorSelection selection = {0};
+    const char *cursor = text;
+    char *end = NULL;
+    long index = 0L;
+
+    if (text == NULL || out_selection == NULL) {
+        return false;
+    }
+
+    if (strcmp(text, "all") == 0) {
+        selection.all = true;
+        *out_selection = selection;
+        return true;
+    }
+    if (strcmp(text, "focused") == 0) {
+        selection.focused = true;
+        *out_selection = selection;
+        return true;
+    }
+
+    for (;;) {
+        errno = 0;
+        index = strtol(cursor, &end, 10);
+        if (errno != 0 || end == cursor || !osd_schema_append_monitor(&selection, index)) {
+            return false;
+        }
+        if (*end == '\0') {
+            break;
+        }
+        if (*end != ',') {
+            return false;
+        }
+        cursor = end + 1;
+    }
+
+    *out_selection = selection;
+    return true;
+}
@@ -0,0 +1,214 @@
+#ifndef HYPRVOLUME_ARGS_SCHEMA_H
+#define HYPRVOLUME_ARGS_SCHEMA_H
+
+#include "args/args.h"
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Value grammar shared by CLI binding, JSON binding, and help generation
+typedef enum {
+    // Bounded unsigned integer, range is [min, max]
+    OSD_SETTING_KIND_UINT = 0,
+    // Bounded signed integer, range is [min, max]
+    OSD_SETTING_KIND_INT = 1,
+    // Non-empty CSS text copied into a fixed buffer
+    OSD_SETTING_KIND_TEXT = 2,
+    // JSON true/false or CLI on/off flag pair
+    OSD_SETTING_KIND_BOOL = 3,
+    // Filesystem path with a companion *_set flag, min is the minimum CLI length
+    OSD_SETTING_KIND_PATH = 4,
+    // Anchor keyword mapped to OSDAnchor
+    OSD_SETTING_KIND_ANCHOR = 5,
+    // Accepted key with no runtime effect (installer-managed)
+    OSD_SETTING_KIND_IGNORED = 6,
+    // Hide mode keyword mapped to OSDHideMode
+    OSD_SETTING_KIND_HIDE_MODE = 7,
+    // Monitor index, index list, or "all" mapped to OSDMonitorSelection, range bounds each index
+    OSD_SETTING_KIND_MONITORS = 8
+} OSDSettingKind;
+
+// Field locators expand to offset, size, and companion *_set flag offset
+#define OSD_SETTING_FIELD(member) offsetof(OSDArgs, member), sizeof(((OSDArgs *)0)->member), 0U
+#define OSD_SETTING_PATH_FIELD(member) \
+    offsetof(OSDArgs, member), sizeof(((OSDArgs *)0)->member), offsetof(OSDArgs, member##_set)
+#define OSD_SETTING_NO_FIELD 0U, 0U, 0U
+
+// Every runtime setting once: X(id, json_key, kind, min, max, field)
+// json_key is NULL for CLI-only settings
+#define OSD_SETTINGS(X)                                                                                             \
+    X(VOLUME_PERCENT, NULL, OSD_SETTING_KIND_INT, 0, 200, OSD_SETTING_FIELD(volume.volume_percent))                 \
+    X(MUTED, NULL, OSD_SETTING_KIND_BOOL, 0, 1, OSD_SETTING_FIELD(volume.muted))                                    \
+    X(WATCH_MODE, "watch_mode", OSD_SETTING_KIND_BOOL, 0, 1, OSD_SETTING_FIELD(watch_mode))                         \
+    X(USE_SYSTEM_VOLUME, "use_system_volume", OSD_SETTING_KIND_BOOL, 0, 1, OSD_SETTING_FIELD(use_system_volume))    \
+    X(ENABLE_SLIDE, "enable_slide", OSD_SETTING_KIND_IGNORED, 0, 1, OSD_SETTING_NO_FIELD)                           \
+    X(CONFIG_PATH, NULL, OSD_SETTING_KIND_PATH, 0, 0, OSD_SETTING_PATH_FIELD(config_path))                          \
+    X(CSS_PATH, "css_file", OSD_SETTING_KIND_PATH, 1, 0, OSD_SETTING_PATH_FIELD(css_path))                          \
+    X(CSS_REPLACE, "css_replace", OSD_SETTING_KIND_BOOL, 0, 1, OSD_SETTING_FIELD(css_replace))                      \
+    X(TIMEOUT_MS, "timeout_ms", OSD_SETTING_KIND_UINT, 100, 10000, OSD_SETTING_FIELD(timeout_ms))                   \
+    X(WATCH_POLL_MS, "watch_poll_ms", OSD_SETTING_KIND_UINT, 40, 2000, OSD_SETTING_FIELD(watch_poll_ms))            \
+    X(HIDE_MODE, "hide_mode", OSD_SETTING_KIND_HIDE_MODE, 0, 0, OSD_SETTING_FIELD(hide_mode))                       \
+    X(FULLSCREEN, "suppress_fullscreen", OSD_SETTING_KIND_BOOL, 0, 1, OSD_SETTING_FIELD(suppress_fullscreen))       \
+    X(MONITOR_INDEX, "monitor_index", OSD_SETTING_KIND_MONITORS, -1, INT_MAX, OSD_SETTING_FIELD(monitors))          \
+    X(ANCHOR, "anchor", OSD_SETTING_KIND_ANCHOR, 0, 0, OSD_SETTING_FIELD(theme.anchor))                             \
+    X(X_PERCENT, "x_percent", OSD_SETTING_KIND_INT, 0, 100, OSD_SETTING_FIELD(theme.x_percent))                     \
+    X(Y_PERCENT, "y_percent", OSD_SETTING_KIND_INT, 0, 100, OSD_SETTING_FIELD(theme.y_percent))                     \
+    X(MARGIN_X, "margin_x", OSD_SETTING_KIND_UINT, 0, 500, OSD_SETTING_FIELD(theme.margin_x_px))                    \
+    X(MARGIN_Y, "margin_y", OSD_SETTING_KIND_UINT, 0, 500, OSD_SETTING_FIELD(theme.margin_y_px))                    \
+    X(WIDTH, "width", OSD_SETTING_KIND_UINT, 40, 1400, OSD_SETTING_FIELD(theme.width_px))                           \
+    X(HEIGHT, "height", OSD_SETTING_KIND_UINT, 20, 300, OSD_SETTING_FIELD(theme.height_px))                         \
+    X(VERTICAL, "vertical", OSD_SETTING_KIND_BOOL, 0, 1, OSD_SETTING_FIELD(theme.vertical_layout))                  \
+    X(RADIUS, "radius", OSD_SETTING_KIND_UINT, 0, 200, OSD_SETTING_FIELD(theme.corner_radius_px))                   \
+    X(ICON_SIZE, "icon_size", OSD_SETTING_KIND_UINT, 8, 200, OSD_SETTING_FIELD(theme.icon_size_px))                 \
+    X(SYSTEM_ICONS, "system_icons", OSD_SETTING_KIND_BOOL, 0, 1, OSD_SETTING_FIELD(theme.system_icons))             \
+    X(FONT_SIZE, "font_size", OSD_SETTING_KIND_UINT, 8, 200, OSD_SETTING_FIELD(theme.font_size_px))                 \
+    X(BACKGROUND_COLOR, "background_color", OSD_SETTING_KIND_TEXT, 0, 0, OSD_SETTING_FIELD(theme.background_color)) \
+    X(BORDER_COLOR, "border_color", OSD_SETTING_KIND_TEXT, 0, 0, OSD_SETTING_FIELD(theme.border_color))             \
+    X(FILL_COLOR, "fill_color", OSD_SETTING_KIND_TEXT, 0, 0, OSD_SETTING_FIELD(theme.fill_color))                   \
+    X(TRACK_COLOR, "track_color", OSD_SETTING_KIND_TEXT, 0, 0, OSD_SETTING_FIELD(theme.track_color))                \
+    X(TEXT_COLOR, "text_color", OSD_SETTING_KIND_TEXT, 0, 0, OSD_SETTING_FIELD(theme.text_color))                   \
+    X(ICON_COLOR, "icon_color", OSD_SETTING_KIND_TEXT, 0, 0, OSD_SETTING_FIELD(theme.icon_color))                   \
+    X(SHOW_HELP, NULL, OSD_SETTING_KIND_BOOL, 0, 1, OSD_SETTING_FIELD(show_help))
+
+#define OSD_SETTING_ENUM_ENTRY(id, json_key, kind, min, max, field) OSD_SETTING_##id,
+typedef enum {
+    OSD_SETTINGS(OSD_SETTING_ENUM_ENTRY)
+    OSD_SETTING_COUNT,
+    // Marks CLI options without a secondary effect
+    OSD_SETTING_NONE = OSD_SETTING_COUNT
+} OSDSettingId;
+#undef OSD_SETTING_ENUM_ENTRY
+
+// Help grouping for CLI options
+typedef enum {
+    OSD_HELP_SECTION_SOURCE = 0,
+    OSD_HELP_SECTION_BEHAVIOR = 1,
+    OSD_HELP_SECTION_THEME = 2,
+    OSD_HELP_SECTION_GENERAL = 3,
+    OSD_HELP_SECTION_COUNT = 4
+} OSDHelpSection;
+
+// How a CLI token binds to its setting
+typedef enum {
+    // Option takes a value parsed by the setting kind
+    OSD_CLI_VALUE = 0,
+    // Flag stores true into a bool setting
+    OSD_CLI_SET_TRUE = 1,
+    // Flag stores false into a bool setting
+    OSD_CLI_SET_FALSE = 2
+} OSDCliAction;
+
+// Every CLI token once, in help order:
+// X(name, setting, action, side_setting, side_value, section, metavar, help)
+// side_setting is forced to side_value whenever the option is used
+// metavar NULL derives "<min-max>" from the setting range, help NULL hides aliases
+#define OSD_CLI_OPTIONS(X)                                                                                  \
+    X("--from-system", USE_SYSTEM_VOLUME, OSD_CLI_SET_TRUE, NONE, false, SOURCE, "",                        \
+      "Read current sink volume from wpctl (default).")                                                     \
+    X("--no-system", USE_SYSTEM_VOLUME, OSD_CLI_SET_FALSE, NONE, false, SOURCE, "",                         \
+      "Use manual values from --value/--muted.")                                                            \
+    X("--value", VOLUME_PERCENT, OSD_CLI_VALUE, USE_SYSTEM_VOLUME, false, SOURCE, NULL,                     \
+      "Manual volume percentage.")                                                                          \
+    X("--muted", MUTED, OSD_CLI_SET_TRUE, NONE, false, SOURCE, "", "Manual muted state.")                   \
+    X("--unmuted", MUTED, OSD_CLI_SET_FALSE, NONE, false, SOURCE, "", "Manual unmuted state.")              \
+    X("--watch", WATCH_MODE, OSD_CLI_SET_TRUE, USE_SYSTEM_VOLUME, true, SOURCE, "",                         \
+      "Poll system volume and show OSD when it changes.")                                                   \
+    X("--no-watch", WATCH_MODE, OSD_CLI_SET_FALSE, NONE, false, SOURCE, "",                                 \
+      "Force single-popup mode even if config enables watch mode.")                                         \
+    X("--one-shot", WATCH_MODE, OSD_CLI_SET_FALSE, NONE, false, SOURCE, "", NULL)                           \
+    X("--timeout-ms", TIMEOUT_MS, OSD_CLI_VALUE, NONE, false, BEHAVIOR, NULL,                               \
+      "Auto-hide delay in milliseconds (default: 1400).")                                                   \
+    X("--watch-poll-ms", WATCH_POLL_MS, OSD_CLI_VALUE, NONE, false, BEHAVIOR, NULL,                         \
+      "Poll interval in watch mode (default: 120).")                                                        \
+    X("--hide-mode", HIDE_MODE, OSD_CLI_VALUE, NONE, false, BEHAVIOR, "<mode>",                             \
+      "Hidden popup handling: unmap (default), keep-mapped, or release.")                                   \
+    X("--suppress-fullscreen", FULLSCREEN, OSD_CLI_SET_TRUE, NONE, false, BEHAVIOR, "",                     \
+      "Skip the popup on monitors showing a fullscreen Hyprland client.")                                   \
+    X("--show-over-fullscreen", FULLSCREEN, OSD_CLI_SET_FALSE, NONE, false, BEHAVIOR, "",                   \
+      "Show the popup over fullscreen clients (default).")                                                  \
+    X("--monitor", MONITOR_INDEX, OSD_CLI_VALUE, NONE, false, BEHAVIOR, "<monitors>",                       \
+      "Target monitor index (0-based, -1 = default), a list like 0,2, all, or focused.")                    \
+    X("--config", CONFIG_PATH, OSD_CLI_VALUE, NONE, false, BEHAVIOR, "<path>",                              \
+      "Load JSON config file before applying CLI overrides.")                                               \
+    X("--css-file", CSS_PATH, OSD_CLI_VALUE, NONE, false, BEHAVIOR, "<path>", "Load custom GTK CSS file.")  \
+    X("--css-replace", CSS_REPLACE, OSD_CLI_SET_TRUE, NONE, false, BEHAVIOR, "",                            \
+      "Use only custom CSS (skip built-in theme CSS).")                                                     \
+    X("--css-append", CSS_REPLACE, OSD_CLI_SET_FALSE, NONE, false, BEHAVIOR, "",                            \
+      "Keep built-in CSS and append custom CSS overrides.")                                                 \
+    X("--vertical", VERTICAL, OSD_CLI_SET_TRUE, NONE, false, BEHAVIOR, "", "Use vertical OSD layout.")      \
+    X("--horizontal", VERTICAL, OSD_CLI_SET_FALSE, NONE, false, BEHAVIOR, "", "Use horizontal OSD layout.") \
+    X("--width", WIDTH, OSD_CLI_VALUE, NONE, false, THEME, NULL, "")                                        \
+    X("--height", HEIGHT, OSD_CLI_VALUE, NONE, false, THEME, NULL, "")                                      \
+    X("--margin-top", MARGIN_Y, OSD_CLI_VALUE, NONE, false, THEME, NULL,                                    \
+      "Vertical offset for top/bottom anchors.")                                                            \
+    X("--radius", RADIUS, OSD_CLI_VALUE, NONE, false, THEME, NULL, "")                                      \
+    X("--icon-size", ICON_SIZE, OSD_CLI_VALUE, NONE, false, THEME, NULL, "")                                \
+    X("--system-icons", SYSTEM_ICONS, OSD_CLI_SET_TRUE, NONE, false, THEME, "",                             \
+      "Use icons from the system icon theme.")                                                              \
+    X("--bundled-icons", SYSTEM_ICONS, OSD_CLI_SET_FALSE, NONE, false, THEME, "",                           \
+      "Use icons embedded in the binary (default).")                                                        \
+    X("--font-size", FONT_SIZE, OSD_CLI_VALUE, NONE, false, THEME, NULL, "")                                \
+    X("--background-color", BACKGROUND_COLOR, OSD_CLI_VALUE, NONE, false, THEME, "<css-color>", "")         \
+    X("--border-color", BORDER_COLOR, OSD_CLI_VALUE, NONE, false, THEME, "<css-color>", "")                 \
+    X("--fill-color", FILL_COLOR, OSD_CLI_VALUE, NONE, false, THEME, "<css-color>", "")                     \
+    X("--track-color", TRACK_COLOR, OSD_CLI_VALUE, NONE, false, THEME, "<css-color>", "")                   \
+    X("--text-color", TEXT_COLOR, OSD_CLI_VALUE, NONE, false, THEME, "<css-color>", "")                     \
+    X("--icon-color", ICON_COLOR, OSD_CLI_VALUE, NONE, false, THEME, "<css-color>", "")                     \
+    X("--help", SHOW_HELP, OSD_CLI_SET_TRUE, NONE, false, GENERAL, "", "Show this help text.")
+
+// One setting row with its binding location inside OSDArgs
+typedef struct {
+    const char *json_key;
+    OSDSettingKind kind;
+    long long min_value;
+    long long max_value;
+    size_t offset;
+    size_t size;
+    // Offset of the *_set flag for path settings, zero otherwise
+    size_t set_flag_offset;
+} OSDSettingDesc;
+
+// One CLI token row
+typedef struct {
+    const char *name;
+    OSDSettingId setting;
+    OSDCliAction action;
+    OSDSettingId side_setting;
+    bool side_value;
+    OSDHelpSection section;
+    const char *metavar;
+    const char *help;
+} OSDCliOptionDesc;
+
+// Returns the setting row for id, or NULL when id is out of range
+const OSDSettingDesc *osd_schema_setting(OSDSettingId id);
+
+// Returns CLI rows in declaration (help) order
+const OSDCliOptionDesc *osd_schema_cli_options(size_t *out_count);
+
+// Perfect-hash lookup of a CLI option name of name_len bytes, NULL when unknown
+const OSDCliOptionDesc *osd_schema_find_cli_option(const char *name, size_t name_len);
+
+// Perfect-hash lookup of a JSON key, OSD_SETTING_NONE when unknown
+OSDSettingId osd_schema_find_json_key(const char *key);
+
+// Checks that the pinned hash seeds still give every CLI option and JSON key its own slot
+// Prints the seed to pin for each table that collides, run by make check after schema edits
+bool osd_schema_check_hash_seeds(FILE *err_stream);
+
+// Maps a hide mode keyword to OSDHideMode, false when the keyword is unknown
+bool osd_schema_parse_hide_mode(const char *text, OSDHideMode *out_mode);
+
+// Appends one monitor index to a list, false when out of range, repeated, mixed with -1, or full
+bool osd_schema_append_monitor(OSDMonitorSelection *selection, long index);
+// Maps "all", "focused", one index, or a comma separated index list to OSDMonitorSelection
+// out_selection is left untouched on failure
+bool osd_schema_parse_monitors(const char *text, OSDMonitorSelection *out_selection);
+
+// Typed field accessors over OSDArgs by setting row
+void *osd_schema_field(OSDArgs *args, const OSDSettingDesc *setting);
+bool *osd_schema_set_flag(OSDArgs *args, const OSDSettingDesc *setting);
+
+#endif
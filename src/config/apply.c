@@ -1,69 +1,39 @@
 #include "config/apply.h"
 
+#include "args/schema.h"
 #include "config/error.h"
 #include "config/json/json_config_fields.h"
 
-#include <limits.h>
-#include <stdlib.h>
 #include <string.h>
 
-// Parses an optional bounded unsigned value from a named key
-static bool parse_ranged_uint_from_key(const char *json_text, const char *key, unsigned int min_value,
-                                       unsigned int max_value, unsigned int *target, FILE *err_stream) {
+// Parses a bounded integer span against the schema range
+static bool parse_ranged_value(const OSDConfigValueSpan *span, const OSDSettingDesc *setting, long *out_value,
+                               FILE *err_stream) {
   long value = 0L;
 
-  if (!osd_config_parse_long_value(json_text, key, &value)) {
-    if (osd_config_find_key(json_text, key) != NULL) {
-      osd_config_write_error_value_message(err_stream, "Config value '", key, "' must be a valid integer\n");
-      return false;
-    }
-    return true;
-  }
-
-  if (value < (long)min_value || value > (long)max_value) {
-    osd_config_write_error_value_message(err_stream, "Config value '", key,
-                                         "' is outside the allowed range\n");
+  if (!osd_config_parse_long_value(span, &value)) {
+    osd_config_write_error_value_message(err_stream, "Config value '", setting->json_key,
+                                         "' must be a valid integer\n");
     return false;
   }
 
-  *target = (unsigned int)value;
-  return true;
-}
-
-// Parses an optional bounded signed value from a named key
-static bool parse_ranged_int_from_key(const char *json_text, const char *key, int min_value, int max_value,
-                                      int *target, FILE *err_stream) {
-  long value = 0L;
-
-  if (!osd_config_parse_long_value(json_text, key, &value)) {
-    if (osd_config_find_key(json_text, key) != NULL) {
-      osd_config_write_error_value_message(err_stream, "Config value '", key, "' must be a valid integer\n");
-      return false;
-    }
-    return true;
-  }
-
-  if (value < (long)min_value || value > (long)max_value) {
-    osd_config_write_error_value_message(err_stream, "Config value '", key,
+  if ((long long)value < setting->min_value || (long long)value > setting->max_value) {
+    osd_config_write_error_value_message(err_stream, "Config value '", setting->json_key,
                                          "' is outside the allowed range\n");
     return false;
   }
 
-  *target = (int)value;
+  *out_value = value;
   return true;
 }
 
 // Maps string anchor values to the internal enum
-static bool parse_anchor_value(const char *json_text, OSDAnchor *target, FILE *err_stream) {
+static bool parse_anchor_value(const OSDConfigValueSpan *span, OSDAnchor *target, FILE *err_stream) {
   char value[32];
-  bool key_present = osd_config_find_key(json_text, "anchor") != NULL;
 
-  if (!osd_config_parse_string_value(json_text, "anchor", value, sizeof(value))) {
-    if (key_present) {
-      osd_config_write_error_text(err_stream, "Config value 'anchor' must be a string\n");
-      return false;
-    }
-    return true;
+  if (!osd_config_parse_string_value(span, value, sizeof(value))) {
+    osd_config_write_error_text(err_stream, "Config value 'anchor' must be a string\n");
+    return false;
   }
 
   if (strcmp(value, "top-center") == 0) {
@@ -95,20 +65,69 @@ static bool parse_anchor_value(const char *json_text, OSDAnchor *target, FILE *e
   return false;
 }
 
-// Parses optional CSS values and rejects empty values
-static bool parse_color_value(const char *json_text, const char *key, char *target, size_t target_size,
-                              FILE *err_stream) {
-  bool key_present = osd_config_find_key(json_text, key) != NULL;
+// Maps hide_mode keywords through the shared schema table
+static bool parse_hide_mode_value(const OSDConfigValueSpan *span, OSDHideMode *target, FILE *err_stream) {
+  char value[32];
+
+  if (!osd_config_parse_string_value(span, value, sizeof(value))) {
+    osd_config_write_error_text(err_stream, "Config value 'hide_mode' must be a string\n");
+    return false;
+  }
+
+  if (!osd_schema_parse_hide_mode(value, target)) {
+    osd_config_write_error_value_message(err_stream, "Invalid config value for 'hide_mode': ", value, "\n");
+    return false;
+  }
+  return true;
+}
 
-  if (!osd_config_parse_string_value(json_text, key, target, target_size)) {
-    if (key_present) {
-      osd_config_write_error_value_message(err_stream, "Config value '", key,
-                                           "' must be a non-empty string\n");
+// Accepts -1 or one index as a number, "all" or "0,2" as a string, or an index array
+static bool parse_monitors_value(const OSDConfigValueSpan *span, OSDMonitorSelection *target, FILE *err_stream) {
+  OSDMonitorSelection selection = {0};
+  long values[OSD_MONITOR_LIST_MAX];
+  size_t count = 0U;
+  char text[64];
+
+  if (*span->start == '"') {
+    if (!osd_config_parse_string_value(span, text, sizeof(text)) || !osd_schema_parse_monitors(text, &selection)) {
+      osd_config_write_error_text(err_stream, "Invalid config value for 'monitor_index'\n");
       return false;
     }
+    *target = selection;
     return true;
   }
 
+  if (*span->start == '[') {
+    if (!osd_config_parse_long_list_value(span, values, OSD_MONITOR_LIST_MAX, &count) || count == 0U) {
+      osd_config_write_error_text(err_stream, "Config value 'monitor_index' must list 1 to 8 indices\n");
+      return false;
+    }
+  } else if (osd_config_parse_long_value(span, &values[0])) {
+    count = 1U;
+  } else {
+    osd_config_write_error_text(err_stream, "Config value 'monitor_index' must be an index, a list, \"all\", or \"focused\"\n");
+    return false;
+  }
+
+  for (size_t index = 0U; index < count; index++) {
+    if (!osd_schema_append_monitor(&selection, values[index])) {
+      osd_config_write_error_text(err_stream, "Config value 'monitor_index' has an invalid or repeated index\n");
+      return false;
+    }
+  }
+  *target = selection;
+  return true;
+}
+
+// Parses optional CSS values and rejects empty values
+static bool parse_color_value(const OSDConfigValueSpan *span, const char *key, char *target, size_t target_size,
+                              FILE *err_stream) {
+  if (!osd_config_parse_string_value(span, target, target_size)) {
+    osd_config_write_error_value_message(err_stream, "Config value '", key,
+                                         "' must be a non-empty string\n");
+    return false;
+  }
+
   if (target[0] == '\0') {
     osd_config_write_error_value_message(err_stream, "Config value '", key, "' cannot be empty\n");
     return false;
@@ -118,17 +137,13 @@ static bool parse_color_value(const char *json_text, const char *key, char *targ
 }
 
 // Parses css_file and updates css path state
-static bool parse_css_file_value(const char *json_text, OSDArgs *args, FILE *err_stream) {
+static bool parse_css_file_value(const OSDConfigValueSpan *span, OSDArgs *args, FILE *err_stream) {
   char value[OSD_CONFIG_PATH_MAX];
-  bool key_present = osd_config_find_key(json_text, "css_file") != NULL;
   size_t value_len = 0U;
 
-  if (!osd_config_parse_string_value(json_text, "css_file", value, sizeof(value))) {
-    if (key_present) {
-      osd_config_write_error_text(err_stream, "Config value 'css_file' must be a string\n");
-      return false;
-    }
-    return true;
+  if (!osd_config_parse_string_value(span, value, sizeof(value))) {
+    osd_config_write_error_text(err_stream, "Config value 'css_file' must be a string\n");
+    return false;
   }
 
   value_len = strlen(value);
@@ -152,107 +167,70 @@ static bool parse_css_file_value(const char *json_text, OSDArgs *args, FILE *err
   return true;
 }
 
-// Applies numeric keys that share CLI-equivalent ranges
-bool osd_config_apply_numeric_values(const char *json_text, OSDArgs *args, FILE *err_stream) {
-  bool ok = true;
+// Parses one boolean span into target
+static bool parse_bool_value(const OSDConfigValueSpan *span, const char *key, bool *target, FILE *err_stream) {
+  bool bool_value = false;
 
-  ok &= parse_ranged_uint_from_key(json_text, "timeout_ms", 100U, 10000U, &args->timeout_ms, err_stream);
-  ok &= parse_ranged_uint_from_key(json_text, "watch_poll_ms", 40U, 2000U, &args->watch_poll_ms, err_stream);
-  ok &= parse_ranged_uint_from_key(json_text, "width", 40U, 1400U, &args->theme.width_px, err_stream);
-  ok &= parse_ranged_uint_from_key(json_text, "height", 20U, 300U, &args->theme.height_px, err_stream);
-  ok &= parse_ranged_uint_from_key(json_text, "margin_x", 0U, 500U, &args->theme.margin_x_px, err_stream);
-  ok &= parse_ranged_uint_from_key(json_text, "margin_y", 0U, 500U, &args->theme.margin_y_px, err_stream);
-  ok &= parse_ranged_int_from_key(json_text, "x_percent", 0, 100, &args->theme.x_percent, err_stream);
-  ok &= parse_ranged_int_from_key(json_text, "y_percent", 0, 100, &args->theme.y_percent, err_stream);
-  ok &= parse_ranged_uint_from_key(json_text, "radius", 0U, 200U, &args->theme.corner_radius_px, err_stream);
-  ok &= parse_ranged_uint_from_key(json_text, "icon_size", 8U, 200U, &args->theme.icon_size_px, err_stream);
-  ok &= parse_ranged_uint_from_key(json_text, "font_size", 8U, 200U, &args->theme.font_size_px, err_stream);
+  if (!osd_config_parse_bool_value(span, &bool_value)) {
+    osd_config_write_error_value_message(err_stream, "Config value '", key, "' must be true or false\n");
+    return false;
+  }
 
-  return ok;
+  *target = bool_value;
+  return true;
 }
 
-// Applies monitor index and sentinel handling
-bool osd_config_apply_monitor_index(const char *json_text, OSDArgs *args, FILE *err_stream) {
-  long monitor_value = 0L;
+// Binds one present key by its schema kind
+static bool apply_setting(const OSDConfigValueSpan *span, const OSDSettingDesc *setting, OSDArgs *args,
+                          FILE *err_stream) {
+  void *field = osd_schema_field(args, setting);
+  long value = 0L;
 
-  if (!osd_config_parse_long_value(json_text, "monitor_index", &monitor_value)) {
-    if (osd_config_find_key(json_text, "monitor_index") != NULL) {
-      osd_config_write_error_text(err_stream, "Config value 'monitor_index' must be a valid integer\n");
+  switch (setting->kind) {
+  case OSD_SETTING_KIND_UINT:
+    if (!parse_ranged_value(span, setting, &value, err_stream)) {
       return false;
     }
+    *(unsigned int *)field = (unsigned int)value;
+    return true;
+  case OSD_SETTING_KIND_INT:
+    if (!parse_ranged_value(span, setting, &value, err_stream)) {
+      return false;
+    }
+    *(int *)field = (int)value;
+    return true;
+  case OSD_SETTING_KIND_BOOL:
+    return parse_bool_value(span, setting->json_key, field, err_stream);
+  case OSD_SETTING_KIND_TEXT:
+    return parse_color_value(span, setting->json_key, field, setting->size, err_stream);
+  case OSD_SETTING_KIND_ANCHOR:
+    return parse_anchor_value(span, field, err_stream);
+  case OSD_SETTING_KIND_HIDE_MODE:
+    return parse_hide_mode_value(span, field, err_stream);
+  case OSD_SETTING_KIND_MONITORS:
+    return parse_monitors_value(span, field, err_stream);
+  case OSD_SETTING_KIND_PATH:
+    // css_file is the only path reachable from JSON
+    return parse_css_file_value(span, args, err_stream);
+  case OSD_SETTING_KIND_IGNORED:
+  default:
+    // Installer-managed keys are accepted without runtime effect
     return true;
   }
-
-  if (monitor_value < -1L || monitor_value > (long)INT_MAX) {
-    osd_config_write_error_text(err_stream, "Config value 'monitor_index' is outside the allowed range\n");
-    return false;
-  }
-
-  args->monitor_index = (int)monitor_value;
-  return true;
 }
 
-// Applies boolean toggles when their keys are present
-bool osd_config_apply_bool_values(const char *json_text, OSDArgs *args, FILE *err_stream) {
-  bool bool_value = false;
-  const char *watch_key = osd_config_find_key(json_text, "watch_mode");
-  const char *system_key = osd_config_find_key(json_text, "use_system_volume");
-  const char *css_replace_key = osd_config_find_key(json_text, "css_replace");
-  const char *vertical_key = osd_config_find_key(json_text, "vertical");
-
-  if (watch_key != NULL && !osd_config_parse_bool_value(json_text, "watch_mode", &bool_value)) {
-    osd_config_write_error_text(err_stream, "Config value 'watch_mode' must be true or false\n");
-    return false;
-  }
-  if (watch_key != NULL) {
-    args->watch_mode = bool_value;
-  }
+bool osd_config_apply_settings(const OSDConfigKeyIndex *index, OSDArgs *args, FILE *err_stream) {
+  bool ok = true;
 
-  if (system_key != NULL && !osd_config_parse_bool_value(json_text, "use_system_volume", &bool_value)) {
-    osd_config_write_error_text(err_stream, "Config value 'use_system_volume' must be true or false\n");
-    return false;
-  }
-  if (system_key != NULL) {
-    args->use_system_volume = bool_value;
-  }
+  for (unsigned int id = 0U; id < (unsigned int)OSD_SETTING_COUNT; id++) {
+    const OSDConfigValueSpan *span = osd_config_index_span(index, id);
 
-  if (css_replace_key != NULL && !osd_config_parse_bool_value(json_text, "css_replace", &bool_value)) {
-    osd_config_write_error_text(err_stream, "Config value 'css_replace' must be true or false\n");
-    return false;
-  }
-  if (css_replace_key != NULL) {
-    args->css_replace = bool_value;
-  }
-
-  if (vertical_key != NULL && !osd_config_parse_bool_value(json_text, "vertical", &bool_value)) {
-    osd_config_write_error_text(err_stream, "Config value 'vertical' must be true or false\n");
-    return false;
-  }
-  if (vertical_key != NULL) {
-    args->theme.vertical_layout = bool_value;
+    // Absent keys leave defaults and earlier CLI values untouched
+    if (span == NULL) {
+      continue;
+    }
+    ok &= apply_setting(span, osd_schema_setting((OSDSettingId)id), args, err_stream);
   }
 
-  return true;
-}
-
-// Applies visual styling keys independently
-bool osd_config_apply_visual_values(const char *json_text, OSDArgs *args, FILE *err_stream) {
-  bool ok = true;
-
-  ok &= parse_anchor_value(json_text, &args->theme.anchor, err_stream);
-  ok &= parse_color_value(json_text, "background_color", args->theme.background_color,
-                          sizeof(args->theme.background_color), err_stream);
-  ok &= parse_color_value(json_text, "border_color", args->theme.border_color,
-                          sizeof(args->theme.border_color), err_stream);
-  ok &= parse_color_value(json_text, "fill_color", args->theme.fill_color, sizeof(args->theme.fill_color),
-                          err_stream);
-  ok &= parse_color_value(json_text, "track_color", args->theme.track_color, sizeof(args->theme.track_color),
-                          err_stream);
-  ok &= parse_color_value(json_text, "text_color", args->theme.text_color, sizeof(args->theme.text_color),
-                          err_stream);
-  ok &= parse_color_value(json_text, "icon_color", args->theme.icon_color, sizeof(args->theme.icon_color),
-                          err_stream);
-  ok &= parse_css_file_value(json_text, args, err_stream);
-
   return ok;
 }
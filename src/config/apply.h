@@ -2,13 +2,13 @@
 #define HYPRVOLUME_CONFIG_APPLY_H
 
 #include "args/args.h"
+#include "config/json/json_config_fields.h"
 
 #include <stdbool.h>
 #include <stdio.h>
 
-bool osd_config_apply_numeric_values(const char *json_text, OSDArgs *args, FILE *err_stream);
-bool osd_config_apply_monitor_index(const char *json_text, OSDArgs *args, FILE *err_stream);
-bool osd_config_apply_bool_values(const char *json_text, OSDArgs *args, FILE *err_stream);
-bool osd_config_apply_visual_values(const char *json_text, OSDArgs *args, FILE *err_stream);
+// Binds every indexed key through the shared settings schema
+// Reports each invalid key and returns false when any key failed
+bool osd_config_apply_settings(const OSDConfigKeyIndex *index, OSDArgs *args, FILE *err_stream);
 
 #endif
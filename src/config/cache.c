@@ -0,0 +1,288 @@
+#include "config/cache.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// "HVCF" in little endian byte order
+#define OSD_CONFIG_CACHE_MAGIC 0x46435648U
+// Bump whenever OSDArgs fields or snapshot layout change meaning
+#define OSD_CONFIG_CACHE_VERSION 7U
+#define OSD_CONFIG_CACHE_DISABLE_ENV "HYPRVOLUME_NO_CONFIG_CACHE"
+#define OSD_FNV_OFFSET_BASIS 0xcbf29ce484222325ULL
+#define OSD_FNV_PRIME 0x100000001b3ULL
+
+// Fixed header followed directly by one raw OSDArgs payload
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    // Layout guard so a rebuilt binary with different struct sizes never reads stale bytes
+    uint32_t args_size;
+    uint32_t reserved;
+    OSDConfigCacheKey key;
+    // FNV-1a over header bytes before this field and the payload
+    uint64_t checksum;
+} OSDConfigCacheHeader;
+
+// Folds raw bytes into a running FNV-1a digest
+static uint64_t osd_config_cache_hash_bytes(uint64_t hash, const void *data, size_t size) {
+    const unsigned char *bytes = data;
+
+    for (size_t index = 0U; index < size; index++) {
+        hash ^= (uint64_t)bytes[index];
+        hash *= OSD_FNV_PRIME;
+    }
+    return hash;
+}
+
+// Strings hash up to their terminator so stale bytes past NUL never affect keys
+static uint64_t osd_config_cache_hash_string(uint64_t hash, const char *text) {
+    return osd_config_cache_hash_bytes(hash, text, strlen(text) + 1U);
+}
+
+static uint64_t osd_config_cache_hash_uint(uint64_t hash, uint64_t value) {
+    return osd_config_cache_hash_bytes(hash, &value, sizeof(value));
+}
+
+static uint64_t osd_config_cache_hash_int(uint64_t hash, int64_t value) {
+    return osd_config_cache_hash_bytes(hash, &value, sizeof(value));
+}
+
+// Digests input args field by field because callers do not zero struct padding
+// Fields no config key can write (volume, muted, config path, help) are left out, so a keybind passing
+// a different --value each press keeps hitting one snapshot, and the caller restores them from its own args
+static uint64_t osd_config_cache_hash_args(const OSDArgs *args) {
+    const OSDTheme *theme = &args->theme;
+    uint64_t hash = OSD_FNV_OFFSET_BASIS;
+
+    hash = osd_config_cache_hash_uint(hash, args->timeout_ms);
+    hash = osd_config_cache_hash_uint(hash, args->watch_poll_ms);
+    hash = osd_config_cache_hash_int(hash, (int64_t)args->hide_mode);
+    hash = osd_config_cache_hash_uint(hash, args->suppress_fullscreen);
+    hash = osd_config_cache_hash_uint(hash, args->monitors.all);
+    hash = osd_config_cache_hash_uint(hash, args->monitors.focused);
+    hash = osd_config_cache_hash_uint(hash, args->monitors.count);
+    for (unsigned int index = 0U; index < args->monitors.count && index < OSD_MONITOR_LIST_MAX; index++) {
+        hash = osd_config_cache_hash_int(hash, args->monitors.indices[index]);
+    }
+    hash = osd_config_cache_hash_string(hash, args->css_path);
+    hash = osd_config_cache_hash_uint(hash, args->css_path_set);
+    hash = osd_config_cache_hash_uint(hash, args->css_replace);
+    hash = osd_config_cache_hash_uint(hash, args->watch_mode);
+    hash = osd_config_cache_hash_uint(hash, args->use_system_volume);
+    hash = osd_config_cache_hash_uint(hash, theme->width_px);
+    hash = osd_config_cache_hash_uint(hash, theme->height_px);
+    hash = osd_config_cache_hash_uint(hash, theme->vertical_layout);
+    hash = osd_config_cache_hash_uint(hash, theme->margin_x_px);
+    hash = osd_config_cache_hash_uint(hash, theme->margin_y_px);
+    hash = osd_config_cache_hash_int(hash, theme->x_percent);
+    hash = osd_config_cache_hash_int(hash, theme->y_percent);
+    hash = osd_config_cache_hash_int(hash, (int64_t)theme->anchor);
+    hash = osd_config_cache_hash_uint(hash, theme->corner_radius_px);
+    hash = osd_config_cache_hash_uint(hash, theme->icon_size_px);
+    hash = osd_config_cache_hash_uint(hash, theme->system_icons);
+    hash = osd_config_cache_hash_uint(hash, theme->font_size_px);
+    hash = osd_config_cache_hash_string(hash, theme->background_color);
+    hash = osd_config_cache_hash_string(hash, theme->border_color);
+    hash = osd_config_cache_hash_string(hash, theme->fill_color);
+    hash = osd_config_cache_hash_string(hash, theme->track_color);
+    hash = osd_config_cache_hash_string(hash, theme->text_color);
+    hash = osd_config_cache_hash_string(hash, theme->icon_color);
+    return hash;
+}
+
+// Word-at-a-time FNV variant keeps checksumming the ~9 KiB payload in the low microseconds
+static uint64_t osd_config_cache_hash_words(uint64_t hash, const void *data, size_t size) {
+    const unsigned char *bytes = data;
+    size_t index = 0U;
+
+    for (; index + sizeof(uint64_t) <= size; index += sizeof(uint64_t)) {
+        uint64_t word = 0U;
+
+        memcpy(&word, bytes + index, sizeof(word));
+        hash ^= word;
+        hash *= OSD_FNV_PRIME;
+    }
+    return osd_config_cache_hash_bytes(hash, bytes + index, size - index);
+}
+
+// Checksum binds the header identity to the payload it describes
+static uint64_t osd_config_cache_checksum(const OSDConfigCacheHeader *header, const OSDArgs *payload) {
+    uint64_t hash = OSD_FNV_OFFSET_BASIS;
+
+    hash = osd_config_cache_hash_words(hash, header, offsetof(OSDConfigCacheHeader, checksum));
+    return osd_config_cache_hash_words(hash, payload, sizeof(*payload));
+}
+
+// Resolves the cache directory from XDG_CACHE_HOME or HOME/.cache
+static bool osd_config_cache_dir(char *out_dir, size_t out_size) {
+    const char *xdg_cache = getenv("XDG_CACHE_HOME");
+    const char *home = NULL;
+    int written = 0;
+
+    // XDG spec ignores relative values
+    if (xdg_cache != NULL && xdg_cache[0] == '/') {
+        written = snprintf(out_dir, out_size, "%s/hyprvolume", xdg_cache);
+    } else {
+        home = getenv("HOME");
+        if (home == NULL || home[0] != '/') {
+            return false;
+        }
+        written = snprintf(out_dir, out_size, "%s/.cache/hyprvolume", home);
+    }
+
+    return written > 0 && (size_t)written < out_size;
+}
+
+static bool osd_config_cache_file_path(char *out_path, size_t out_size) {
+    char cache_dir[OSD_CONFIG_PATH_MAX];
+    int written = 0;
+
+    if (!osd_config_cache_dir(cache_dir, sizeof(cache_dir))) {
+        return false;
+    }
+
+    written = snprintf(out_path, out_size, "%s/config.bin", cache_dir);
+    return written > 0 && (size_t)written < out_size;
+}
+
+bool osd_config_cache_make_key(const char *path, const OSDArgs *input_args, OSDConfigCacheKey *out_key) {
+    struct stat config_stat;
+    const char *disabled = NULL;
+
+    if (path == NULL || input_args == NULL || out_key == NULL) {
+        return false;
+    }
+
+    disabled = getenv(OSD_CONFIG_CACHE_DISABLE_ENV);
+    if (disabled != NULL && strcmp(disabled, "1") == 0) {
+        // Escape hatch for debugging config parsing itself
+        return false;
+    }
+
+    // Stat happens before the JSON read so a concurrent edit can only cause a miss
+    if (stat(path, &config_stat) != 0 || !S_ISREG(config_stat.st_mode)) {
+        return false;
+    }
+
+    memset(out_key, 0, sizeof(*out_key));
+    out_key->path_hash = osd_config_cache_hash_string(OSD_FNV_OFFSET_BASIS, path);
+    out_key->input_hash = osd_config_cache_hash_args(input_args);
+    out_key->mtime_sec = (int64_t)config_stat.st_mtim.tv_sec;
+    out_key->mtime_nsec = (int64_t)config_stat.st_mtim.tv_nsec;
+    out_key->size_bytes = (uint64_t)config_stat.st_size;
+    out_key->inode = (uint64_t)config_stat.st_ino;
+    out_key->device = (uint64_t)config_stat.st_dev;
+    return true;
+}
+
+bool osd_config_cache_load(const OSDConfigCacheKey *key, OSDArgs *out_args) {
+    char cache_path[OSD_CONFIG_PATH_MAX];
+    const size_t snapshot_size = sizeof(OSDConfigCacheHeader) + sizeof(OSDArgs);
+    struct stat cache_stat;
+    const OSDConfigCacheHeader *header = NULL;
+    OSDArgs payload;
+    void *mapping = NULL;
+    int fd = -1;
+    bool ok = false;
+
+    if (key == NULL || out_args == NULL || !osd_config_cache_file_path(cache_path, sizeof(cache_path))) {
+        return false;
+    }
+
+    fd = open(cache_path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    if (fstat(fd, &cache_stat) != 0 || !S_ISREG(cache_stat.st_mode) || (size_t)cache_stat.st_size != snapshot_size) {
+        (void)close(fd);
+        return false;
+    }
+
+    mapping = mmap(NULL, snapshot_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // Mapping stays valid after close
+    (void)close(fd);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    header = mapping;
+    // Payload is copied out because the header size does not guarantee its alignment
+    memcpy(&payload, (const unsigned char *)mapping + sizeof(*header), sizeof(payload));
+    if (header->magic == OSD_CONFIG_CACHE_MAGIC && header->version == OSD_CONFIG_CACHE_VERSION &&
+        header->args_size == (uint32_t)sizeof(OSDArgs) && memcmp(&header->key, key, sizeof(*key)) == 0 &&
+        header->checksum == osd_config_cache_checksum(header, &payload)) {
+        *out_args = payload;
+        ok = true;
+    }
+
+    (void)munmap(mapping, snapshot_size);
+    return ok;
+}
+
+// Creates one directory level and treats an existing directory as success
+static bool osd_config_cache_ensure_dir(const char *path) {
+    if (mkdir(path, 0700) == 0 || errno == EEXIST) {
+        return true;
+    }
+    return false;
+}
+
+void osd_config_cache_store(const OSDConfigCacheKey *key, const OSDArgs *resolved_args) {
+    char cache_dir[OSD_CONFIG_PATH_MAX];
+    char cache_path[OSD_CONFIG_PATH_MAX];
+    char temp_path[OSD_CONFIG_PATH_MAX + 16U];
+    char *parent_end = NULL;
+    OSDConfigCacheHeader header;
+    int fd = -1;
+    int written = 0;
+    bool ok = true;
+
+    if (key == NULL || resolved_args == NULL || !osd_config_cache_dir(cache_dir, sizeof(cache_dir)) ||
+        !osd_config_cache_file_path(cache_path, sizeof(cache_path))) {
+        return;
+    }
+
+    // Parent of the hyprvolume directory may itself be missing on fresh accounts
+    parent_end = strrchr(cache_dir, '/');
+    if (parent_end != NULL && parent_end != cache_dir) {
+        *parent_end = '\0';
+        (void)osd_config_cache_ensure_dir(cache_dir);
+        *parent_end = '/';
+    }
+    if (!osd_config_cache_ensure_dir(cache_dir)) {
+        return;
+    }
+
+    written = snprintf(temp_path, sizeof(temp_path), "%s.XXXXXX", cache_path);
+    if (written <= 0 || (size_t)written >= sizeof(temp_path)) {
+        return;
+    }
+
+    memset(&header, 0, sizeof(header));
+    header.magic = OSD_CONFIG_CACHE_MAGIC;
+    header.version = OSD_CONFIG_CACHE_VERSION;
+    header.args_size = (uint32_t)sizeof(OSDArgs);
+    header.key = *key;
+    header.checksum = osd_config_cache_checksum(&header, resolved_args);
+
+    fd = mkstemp(temp_path);
+    if (fd < 0) {
+        return;
+    }
+
+    ok &= write(fd, &header, sizeof(header)) == (ssize_t)sizeof(header);
+    ok &= write(fd, resolved_args, sizeof(*resolved_args)) == (ssize_t)sizeof(*resolved_args);
+    ok &= close(fd) == 0;
+
+    // Rename publishes the snapshot atomically so readers never see a partial file
+    if (!ok || rename(temp_path, cache_path) != 0) {
+        (void)unlink(temp_path);
+    }
+}
@@ -0,0 +1,32 @@
+#ifndef HYPRVOLUME_CONFIG_CACHE_H
+#define HYPRVOLUME_CONFIG_CACHE_H
+
+#include "args/args.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Identity of one config resolution: source file metadata plus the args it was applied over
+typedef struct {
+    uint64_t path_hash;
+    uint64_t input_hash;
+    int64_t mtime_sec;
+    int64_t mtime_nsec;
+    uint64_t size_bytes;
+    uint64_t inode;
+    uint64_t device;
+} OSDConfigCacheKey;
+
+// Stats the config file and digests input args into a cache key
+// Returns false when the file cannot be stat'ed or caching is disabled
+bool osd_config_cache_make_key(const char *path, const OSDArgs *input_args, OSDConfigCacheKey *out_key);
+
+// Loads resolved args from the binary snapshot when every key field and the checksum match
+// Volume, muted, config path, and help are not part of the key, so callers copy them back from their input args
+// Any mismatch or I/O failure returns false silently so callers fall back to JSON parsing
+bool osd_config_cache_load(const OSDConfigCacheKey *key, OSDArgs *out_args);
+
+// Best effort atomic snapshot write; failures are silent and never affect startup
+void osd_config_cache_store(const OSDConfigCacheKey *key, const OSDArgs *resolved_args);
+
+#endif
@@ -1,42 +1,51 @@
 #include "config/config.h"
 
 #include "config/apply.h"
+#include "config/cache.h"
 #include "config/error.h"
 #include "config/io.h"
-#include "config/json/json_config_fields.h"
 #include "config/schema.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 // Entry point for JSON config loading and structured field application
 bool osd_config_apply_file(const char *path, OSDArgs *args, FILE *err_stream) {
     char *json_text = NULL;
+    OSDConfigKeyIndex index;
     OSDArgs parsed_args;
+    OSDConfigCacheKey cache_key;
+    bool cache_usable = false;
     bool ok = true;
 
     if (path == NULL || args == NULL || err_stream == NULL) {
         return false;
     }
-    parsed_args = *args;
 
-    if (!osd_config_read_file_text(path, &json_text, err_stream)) {
-        return false;
+    // Snapshot hit skips file read, indexing, and every field parser
+    cache_usable = osd_config_cache_make_key(path, args, &cache_key);
+    if (cache_usable && osd_config_cache_load(&cache_key, &parsed_args)) {
+        // Config cannot set these, so this invocation's values win over whichever run wrote the snapshot
+        parsed_args.volume = args->volume;
+        parsed_args.show_help = args->show_help;
+        parsed_args.config_path_set = args->config_path_set;
+        memcpy(parsed_args.config_path, args->config_path, sizeof(parsed_args.config_path));
+        *args = parsed_args;
+        return true;
     }
+    parsed_args = *args;
 
-    if (!osd_config_validate_json_envelope(json_text, err_stream)) {
-        free(json_text);
+    if (!osd_config_read_file_text(path, &json_text, err_stream)) {
         return false;
     }
 
-    if (!osd_config_schema_validate_top_level_keys(json_text, err_stream)) {
+    // One pass validates the envelope and indexes every top-level value span
+    if (!osd_config_schema_build_index(json_text, &index, err_stream)) {
         free(json_text);
         return false;
     }
 
-    ok &= osd_config_apply_numeric_values(json_text, &parsed_args, err_stream);
-    ok &= osd_config_apply_monitor_index(json_text, &parsed_args, err_stream);
-    ok &= osd_config_apply_bool_values(json_text, &parsed_args, err_stream);
-    ok &= osd_config_apply_visual_values(json_text, &parsed_args, err_stream);
+    ok &= osd_config_apply_settings(&index, &parsed_args, err_stream);
 
     if (ok && parsed_args.css_replace && !parsed_args.css_path_set) {
         osd_config_write_error_text(err_stream, "Config value 'css_replace' requires a non-empty 'css_file'\n");
@@ -45,6 +54,10 @@ bool osd_config_apply_file(const char *path, OSDArgs *args, FILE *err_stream) {
 
     if (ok) {
         *args = parsed_args;
+        if (cache_usable) {
+            // Only fully validated results are snapshotted
+            osd_config_cache_store(&cache_key, &parsed_args);
+        }
     }
 
     free(json_text);
@@ -5,16 +5,44 @@
 #include <stddef.h>
 #include <stdio.h>
 
-const char *osd_config_find_key(const char *json_text, const char *key);
-bool osd_config_validate_json_envelope(const char *json_text, FILE *err_stream);
-bool osd_config_validate_top_level_keys(
+/* Upper bound for key slots accepted by the key index. */
+#define OSD_CONFIG_INDEX_MAX_KEYS 32U
+
+/* Maps a key to its slot below slot_count, or returns slot_count when the key is unknown. */
+typedef size_t (*OSDConfigKeyLookupFn)(const char *key);
+
+/* Byte range of one top-level value token inside the config text. */
+typedef struct {
+    /* First value byte after ':' and leading whitespace. */
+    const char *start;
+    /* One past the last byte of the value token. */
+    const char *end;
+} OSDConfigValueSpan;
+
+/* Top-level key to value-span index built in a single pass. */
+typedef struct {
+    /* Number of slots the lookup can return. */
+    size_t slot_count;
+    /* Value span per key slot, start is NULL when the key is absent. */
+    OSDConfigValueSpan values[OSD_CONFIG_INDEX_MAX_KEYS];
+} OSDConfigKeyIndex;
+
+bool osd_config_build_key_index(
     const char *json_text,
-    const char *const *allowed_keys,
-    size_t allowed_key_count,
+    OSDConfigKeyLookupFn lookup_key,
+    size_t slot_count,
+    OSDConfigKeyIndex *out_index,
     FILE *err_stream
 );
-bool osd_config_parse_long_value(const char *json_text, const char *key, long *out_value);
-bool osd_config_parse_bool_value(const char *json_text, const char *key, bool *out_value);
-bool osd_config_parse_string_value(const char *json_text, const char *key, char *out_buffer, size_t out_size);
+const OSDConfigValueSpan *osd_config_index_span(const OSDConfigKeyIndex *index, size_t slot);
+bool osd_config_parse_long_value(const OSDConfigValueSpan *span, long *out_value);
+bool osd_config_parse_long_list_value(
+    const OSDConfigValueSpan *span,
+    long *out_values,
+    size_t max_values,
+    size_t *out_count
+);
+bool osd_config_parse_bool_value(const OSDConfigValueSpan *span, bool *out_value);
+bool osd_config_parse_string_value(const OSDConfigValueSpan *span, char *out_buffer, size_t out_size);
 
 #endif
@@ -0,0 +1,222 @@
+#include "config/json/json_config_fields.h"
+#include "config/json/json_token_scan_internal.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Writes a fixed parser error message. */
+static void osd_config_write_error_literal(FILE *err_stream, const char *message) {
+    if (err_stream == NULL || message == NULL) {
+        return;
+    }
+    /* Fixed-string path avoids formatter complexity in error handling. */
+    (void)fputs(message, err_stream);
+}
+
+/* Writes an error message formed as prefix + key + suffix. */
+static void osd_config_write_error_key(FILE *err_stream, const char *prefix, const char *key, const char *suffix) {
+    size_t key_length = 0U;
+
+    if (err_stream == NULL || prefix == NULL || key == NULL || suffix == NULL) {
+        return;
+    }
+
+    key_length = strlen(key);
+    /* Prefix/suffix are fixed literals owned by call sites. */
+    (void)fputs(prefix, err_stream);
+    if (key_length > 0U) {
+        /* Raw key write avoids temporary format buffers. */
+        (void)fwrite(key, 1U, key_length, err_stream);
+    }
+    (void)fputs(suffix, err_stream);
+}
+
+/*
+ * Builds the top-level key index in one pass over the config text.
+ * The same walk enforces the envelope rules (single top-level object, no
+ * trailing payload), the key schema, duplicate-key rejection, and trailing
+ * comma rejection, so apply code never has to rescan the text per key.
+ */
+bool osd_config_build_key_index(
+    const char *json_text,
+    OSDConfigKeyLookupFn lookup_key,
+    size_t slot_count,
+    OSDConfigKeyIndex *out_index,
+    FILE *err_stream
+) {
+    OSDConfigKeyIndex index;
+    const char *cursor = NULL;
+    bool ok = true;
+
+    if (json_text == NULL || lookup_key == NULL || out_index == NULL || err_stream == NULL) {
+        return false;
+    }
+    if (slot_count > OSD_CONFIG_INDEX_MAX_KEYS) {
+        osd_config_write_error_literal(err_stream, "Config key schema exceeds index capacity\n");
+        return false;
+    }
+
+    memset(&index, 0, sizeof(index));
+    index.slot_count = slot_count;
+
+    cursor = osd_json_skip_whitespace(json_text);
+    if (cursor == NULL || *cursor != '{') {
+        osd_config_write_error_literal(err_stream, "Config file must be a JSON object\n");
+        return false;
+    }
+
+    cursor++;
+    /* Parse strict top-level key/value pairs one item at a time. */
+    while (ok) {
+        char key_buffer[128];
+        size_t key_length = 0U;
+        bool escaped = false;
+        size_t key_index = 0U;
+        const char *key_end = NULL;
+        const char *value_start = NULL;
+
+        cursor = osd_json_skip_whitespace(cursor);
+        if (cursor == NULL || *cursor == '\0') {
+            /* Unexpected end-of-buffer means the root object never closed. */
+            osd_config_write_error_literal(err_stream, "Config file is malformed JSON\n");
+            ok = false;
+            break;
+        }
+        if (*cursor == '}') {
+            /* Empty object or fully-consumed object is valid termination. */
+            break;
+        }
+        if (*cursor != '"') {
+            osd_config_write_error_literal(err_stream, "Config object key must be a JSON string\n");
+            ok = false;
+            break;
+        }
+
+        key_end = osd_json_skip_string_token(cursor);
+        if (key_end == NULL) {
+            osd_config_write_error_literal(err_stream, "Config key string is not terminated\n");
+            ok = false;
+            break;
+        }
+
+        /* Copy key content between the quotes and drop escape backslashes. */
+        cursor++;
+        while (cursor < key_end - 1) {
+            if (!escaped && *cursor == '\\') {
+                escaped = true;
+                cursor++;
+                continue;
+            }
+            if (key_length + 1U >= sizeof(key_buffer)) {
+                osd_config_write_error_literal(err_stream, "Config key exceeds supported length\n");
+                ok = false;
+                break;
+            }
+
+            /* Keep raw key bytes for exact allowlist comparison. */
+            key_buffer[key_length] = *cursor;
+            key_length++;
+            escaped = false;
+            cursor++;
+        }
+        if (!ok) {
+            break;
+        }
+        key_buffer[key_length] = '\0';
+        cursor = key_end;
+
+        cursor = osd_json_skip_whitespace(cursor);
+        if (cursor == NULL || *cursor != ':') {
+            osd_config_write_error_key(err_stream, "Config key '", key_buffer, "' is missing ':' separator\n");
+            ok = false;
+            break;
+        }
+        /* Move to the value token start for this key. */
+        cursor++;
+
+        key_index = lookup_key(key_buffer);
+        if (key_index >= slot_count) {
+            osd_config_write_error_key(err_stream, "Unknown config key '", key_buffer, "'\n");
+            ok = false;
+            break;
+        }
+        if (index.values[key_index].start != NULL) {
+            /* Duplicate key ambiguity is rejected by policy. */
+            osd_config_write_error_key(err_stream, "Duplicate config key '", key_buffer, "' is not allowed\n");
+            ok = false;
+            break;
+        }
+
+        value_start = osd_json_skip_whitespace(cursor);
+        cursor = osd_json_skip_value_token(value_start);
+        if (cursor == NULL && value_start != NULL && (*value_start == '"' || *value_start == '{' || *value_start == '[')) {
+            /* Unterminated strings or containers leave the whole document unbalanced. */
+            osd_config_write_error_literal(err_stream, "Config file is malformed JSON\n");
+            ok = false;
+            break;
+        }
+        if (cursor == NULL) {
+            osd_config_write_error_key(err_stream, "Config key '", key_buffer, "' has an invalid JSON value\n");
+            ok = false;
+            break;
+        }
+
+        /* Span is recorded only after the value token proved well-formed. */
+        index.values[key_index].start = value_start;
+        index.values[key_index].end = cursor;
+
+        cursor = osd_json_skip_whitespace(cursor);
+        if (cursor == NULL || *cursor == '\0') {
+            osd_config_write_error_literal(err_stream, "Config file is malformed JSON\n");
+            ok = false;
+            break;
+        }
+        if (*cursor == ',') {
+            /* Comma means another key/value pair should follow. */
+            cursor++;
+            cursor = osd_json_skip_whitespace(cursor);
+            if (cursor == NULL || *cursor == '\0') {
+                osd_config_write_error_literal(err_stream, "Config file is malformed JSON\n");
+                ok = false;
+                break;
+            }
+            if (*cursor == '}') {
+                /* Trailing comma after last key is rejected explicitly. */
+                osd_config_write_error_literal(err_stream, "Config object has a trailing comma\n");
+                ok = false;
+                break;
+            }
+            continue;
+        }
+        if (*cursor == '}') {
+            /* Clean end of object after current key/value pair. */
+            break;
+        }
+
+        osd_config_write_error_key(err_stream, "Config object key '", key_buffer, "' is followed by invalid separator\n");
+        ok = false;
+        break;
+    }
+
+    if (ok) {
+        // Root object must be the only non-whitespace payload in the file
+        cursor = osd_json_skip_whitespace(cursor + 1);
+        if (cursor == NULL || *cursor != '\0') {
+            osd_config_write_error_literal(err_stream, "Config file must contain exactly one JSON object\n");
+            ok = false;
+        }
+    }
+
+    if (ok) {
+        *out_index = index;
+    }
+    return ok;
+}
+
+/* Returns the indexed value span for a key slot, or NULL when the key is absent. */
+const OSDConfigValueSpan *osd_config_index_span(const OSDConfigKeyIndex *index, size_t slot) {
+    if (index == NULL || slot >= index->slot_count) {
+        return NULL;
+    }
+
+    return (index->values[slot].start != NULL) ? &index->values[slot] : NULL;
+}
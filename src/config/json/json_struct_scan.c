@@ -0,0 +1,262 @@
+#include "config/json/json_struct_scan_internal.h"
+
+#if !defined(OSD_JSON_SCAN_SCALAR_ONLY) && defined(__AVX2__)
+#include <immintrin.h>
+#define OSD_JSON_SCAN_AVX2 1
+#elif !defined(OSD_JSON_SCAN_SCALAR_ONLY) && defined(__SSE2__)
+#include <emmintrin.h>
+#define OSD_JSON_SCAN_SSE2 1
+#elif !defined(OSD_JSON_SCAN_SCALAR_ONLY) && defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define OSD_JSON_SCAN_NEON 1
+#endif
+
+#if defined(OSD_JSON_SCAN_AVX2) || defined(OSD_JSON_SCAN_SSE2) || defined(OSD_JSON_SCAN_NEON)
+#define OSD_JSON_SCAN_HAS_SIMD 1
+#endif
+
+/* Per-block byte class masks, one bit per input byte. */
+typedef struct {
+  uint64_t quote;
+  uint64_t backslash;
+  uint64_t op;
+} OSDJsonBlockMasks;
+
+/* Structural bytes that delimit JSON tokens outside strings. */
+static bool is_structural_byte(unsigned char byte) {
+  return byte == '{' || byte == '}' || byte == '[' || byte == ']' || byte == ':' || byte == ',';
+}
+
+void osd_json_scanner_init(OSDJsonScanner *scanner) {
+  if (scanner == NULL) {
+    return;
+  }
+
+  scanner->offset = 0U;
+  scanner->escape_carry = 0U;
+  scanner->string_carry = 0U;
+}
+
+bool osd_json_scanner_in_string(const OSDJsonScanner *scanner) {
+  return scanner != NULL && scanner->string_carry != 0U;
+}
+
+#if defined(OSD_JSON_SCAN_AVX2)
+/* Classifies 64 bytes with two 32-byte compares per byte class. */
+static OSDJsonBlockMasks classify_block(const unsigned char *block) {
+  OSDJsonBlockMasks masks;
+  uint64_t halves[3][2];
+  int half = 0;
+
+  for (half = 0; half < 2; half++) {
+    __m256i bytes = _mm256_loadu_si256((const __m256i *)(const void *)(block + (half * 32)));
+    __m256i op = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('{')), _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('}'))),
+        _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('[')),
+                            _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(']'))),
+            _mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(':')),
+                            _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(',')))));
+
+    halves[0][half] = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('"')));
+    halves[1][half] = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\\')));
+    halves[2][half] = (uint32_t)_mm256_movemask_epi8(op);
+  }
+
+  masks.quote = halves[0][0] | (halves[0][1] << 32);
+  masks.backslash = halves[1][0] | (halves[1][1] << 32);
+  masks.op = halves[2][0] | (halves[2][1] << 32);
+  return masks;
+}
+#elif defined(OSD_JSON_SCAN_SSE2)
+/* Classifies 64 bytes with four 16-byte compares per byte class. */
+static OSDJsonBlockMasks classify_block(const unsigned char *block) {
+  OSDJsonBlockMasks masks = {0U, 0U, 0U};
+  int lane = 0;
+
+  for (lane = 0; lane < 4; lane++) {
+    __m128i bytes = _mm_loadu_si128((const __m128i *)(const void *)(block + (lane * 16)));
+    __m128i op = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('{')), _mm_cmpeq_epi8(bytes, _mm_set1_epi8('}'))),
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('[')), _mm_cmpeq_epi8(bytes, _mm_set1_epi8(']'))),
+                     _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(':')), _mm_cmpeq_epi8(bytes, _mm_set1_epi8(',')))));
+    unsigned int shift = (unsigned int)lane * 16U;
+
+    masks.quote |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('"'))) << shift;
+    masks.backslash |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\\'))) << shift;
+    masks.op |= (uint64_t)(uint16_t)_mm_movemask_epi8(op) << shift;
+  }
+
+  return masks;
+}
+#elif defined(OSD_JSON_SCAN_NEON)
+/* Collapses four 16-byte compare results into one 64-bit mask. */
+static uint64_t neon_to_bitmask(uint8x16_t m0, uint8x16_t m1, uint8x16_t m2, uint8x16_t m3) {
+  static const uint8_t bit_values[16] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+                                         0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
+  uint8x16_t bits = vld1q_u8(bit_values);
+  uint8x16_t sum0 = vpaddq_u8(vandq_u8(m0, bits), vandq_u8(m1, bits));
+  uint8x16_t sum1 = vpaddq_u8(vandq_u8(m2, bits), vandq_u8(m3, bits));
+
+  sum0 = vpaddq_u8(sum0, sum1);
+  sum0 = vpaddq_u8(sum0, sum0);
+  return vgetq_lane_u64(vreinterpretq_u64_u8(sum0), 0);
+}
+
+/* Builds the structural operator mask for one 16-byte lane. */
+static uint8x16_t neon_op_mask(uint8x16_t bytes) {
+  return vorrq_u8(vorrq_u8(vorrq_u8(vceqq_u8(bytes, vdupq_n_u8('{')), vceqq_u8(bytes, vdupq_n_u8('}'))),
+                           vorrq_u8(vceqq_u8(bytes, vdupq_n_u8('[')), vceqq_u8(bytes, vdupq_n_u8(']')))),
+                  vorrq_u8(vceqq_u8(bytes, vdupq_n_u8(':')), vceqq_u8(bytes, vdupq_n_u8(','))));
+}
+
+/* Classifies 64 bytes with four 16-byte compares per byte class. */
+static OSDJsonBlockMasks classify_block(const unsigned char *block) {
+  OSDJsonBlockMasks masks;
+  uint8x16_t b0 = vld1q_u8(block);
+  uint8x16_t b1 = vld1q_u8(block + 16);
+  uint8x16_t b2 = vld1q_u8(block + 32);
+  uint8x16_t b3 = vld1q_u8(block + 48);
+  uint8x16_t quote = vdupq_n_u8('"');
+  uint8x16_t backslash = vdupq_n_u8('\\');
+
+  masks.quote = neon_to_bitmask(vceqq_u8(b0, quote), vceqq_u8(b1, quote), vceqq_u8(b2, quote), vceqq_u8(b3, quote));
+  masks.backslash = neon_to_bitmask(vceqq_u8(b0, backslash), vceqq_u8(b1, backslash), vceqq_u8(b2, backslash),
+                                    vceqq_u8(b3, backslash));
+  masks.op = neon_to_bitmask(neon_op_mask(b0), neon_op_mask(b1), neon_op_mask(b2), neon_op_mask(b3));
+  return masks;
+}
+#endif
+
+#if defined(OSD_JSON_SCAN_HAS_SIMD)
+/*
+ * Marks bytes escaped by odd-length backslash runs.
+ * Subtracting the run starts from the odd-bit pattern flips runs that begin on
+ * odd positions, so one add/xor pass separates odd runs from even runs.
+ */
+static uint64_t find_escaped_bytes(uint64_t backslash, uint64_t *escape_carry) {
+  const uint64_t odd_bits = 0xAAAAAAAAAAAAAAAAULL;
+  uint64_t potential_escape = 0U;
+  uint64_t escape_and_terminal = 0U;
+  uint64_t escaped = 0U;
+
+  if (backslash == 0U) {
+    // Only a carried escape can affect a block without backslashes
+    escaped = *escape_carry;
+    *escape_carry = 0U;
+    return escaped;
+  }
+
+  potential_escape = backslash & ~*escape_carry;
+  escape_and_terminal = (((potential_escape << 1) | odd_bits) - potential_escape) ^ odd_bits;
+  escaped = escape_and_terminal ^ (backslash | *escape_carry);
+  // A backslash in the last byte that is itself an escape carries into the next block
+  *escape_carry = (escape_and_terminal & backslash) >> 63;
+  return escaped;
+}
+
+/* Turns quote boundaries into an inclusive-start in-string mask. */
+static uint64_t prefix_xor(uint64_t bits) {
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+/* Resolves one classified block into emitted structural offsets. */
+static size_t emit_block(OSDJsonScanner *scanner, const OSDJsonBlockMasks *masks, size_t *out_offsets) {
+  uint64_t escaped = find_escaped_bytes(masks->backslash, &scanner->escape_carry);
+  uint64_t quotes = masks->quote & ~escaped;
+  uint64_t in_string = prefix_xor(quotes) ^ scanner->string_carry;
+  uint64_t structurals = (masks->op & ~in_string) | quotes;
+  size_t emitted = 0U;
+
+  // Sign of the last byte decides whether the next block starts inside a string
+  scanner->string_carry = 0U - (in_string >> 63);
+
+  while (structurals != 0U) {
+    out_offsets[emitted] = scanner->offset + (size_t)__builtin_ctzll(structurals);
+    emitted++;
+    structurals &= structurals - 1U;
+  }
+
+  return emitted;
+}
+#endif
+
+/* Portable byte loop with the same escape and string semantics as block mode. */
+static bool scan_scalar_byte(OSDJsonScanner *scanner, unsigned char byte) {
+  bool is_escaped = scanner->escape_carry != 0U;
+
+  scanner->escape_carry = 0U;
+  if (byte == '\\' && !is_escaped) {
+    // Backslash escapes exactly one following byte
+    scanner->escape_carry = 1U;
+    return false;
+  }
+  if (byte == '"' && !is_escaped) {
+    scanner->string_carry = ~scanner->string_carry;
+    return true;
+  }
+
+  return scanner->string_carry == 0U && is_structural_byte(byte);
+}
+
+size_t osd_json_scanner_feed(
+    OSDJsonScanner *scanner,
+    const char *chunk,
+    size_t chunk_len,
+    size_t *out_offsets,
+    size_t out_capacity,
+    size_t *out_count
+) {
+  const unsigned char *bytes = (const unsigned char *)chunk;
+  size_t consumed = 0U;
+  size_t count = 0U;
+
+  if (scanner == NULL || chunk == NULL || out_offsets == NULL || out_count == NULL) {
+    return 0U;
+  }
+
+  count = *out_count;
+
+#if defined(OSD_JSON_SCAN_HAS_SIMD)
+  // Full blocks run vector classification while the batch can hold a worst-case block
+  while ((chunk_len - consumed) >= OSD_JSON_SCAN_BLOCK_BYTES && count <= out_capacity &&
+         (out_capacity - count) >= OSD_JSON_SCAN_BLOCK_BYTES) {
+    OSDJsonBlockMasks masks = classify_block(bytes + consumed);
+
+    count += emit_block(scanner, &masks, out_offsets + count);
+    scanner->offset += OSD_JSON_SCAN_BLOCK_BYTES;
+    consumed += OSD_JSON_SCAN_BLOCK_BYTES;
+  }
+#endif
+
+  // Tail bytes and scalar-only builds share one byte-at-a-time path
+  while (consumed < chunk_len && count < out_capacity) {
+    if (scan_scalar_byte(scanner, bytes[consumed])) {
+      out_offsets[count] = scanner->offset;
+      count++;
+    }
+    scanner->offset++;
+    consumed++;
+  }
+
+  *out_count = count;
+  return consumed;
+}
+
+const char *osd_json_scanner_backend_name(void) {
+#if defined(OSD_JSON_SCAN_AVX2)
+  return "avx2";
+#elif defined(OSD_JSON_SCAN_SSE2)
+  return "sse2";
+#elif defined(OSD_JSON_SCAN_NEON)
+  return "neon";
+#else
+  return "scalar";
+#endif
+}
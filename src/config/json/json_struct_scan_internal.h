@@ -0,0 +1,49 @@
+#ifndef HYPRVOLUME_CONFIG_JSON_STRUCT_SCAN_INTERNAL_H
+#define HYPRVOLUME_CONFIG_JSON_STRUCT_SCAN_INTERNAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Bytes classified per vector block; also the largest batch one block can emit. */
+#define OSD_JSON_SCAN_BLOCK_BYTES 64U
+
+/*
+ * Resumable structural scanner state.
+ * Escape and in-string carries survive chunk boundaries so input can be fed
+ * in arbitrary slices. Build with -DOSD_JSON_SCAN_SCALAR_ONLY to force the
+ * portable byte loop instead of SSE2/AVX2/NEON block classification.
+ */
+typedef struct {
+  /* Absolute offset of the next byte to be fed. */
+  size_t offset;
+  /* Bit 0 set when the next byte is escaped by a trailing backslash. */
+  uint64_t escape_carry;
+  /* All ones while the scanner is inside a string, zero otherwise. */
+  uint64_t string_carry;
+} OSDJsonScanner;
+
+void osd_json_scanner_init(OSDJsonScanner *scanner);
+
+/*
+ * Feeds one chunk and appends absolute offsets of every unescaped quote and
+ * of every structural byte ({ } [ ] : ,) outside strings to out_offsets.
+ * Stops early when out_offsets has no room for another block and returns the
+ * number of chunk bytes consumed so the caller can drain and resume.
+ */
+size_t osd_json_scanner_feed(
+    OSDJsonScanner *scanner,
+    const char *chunk,
+    size_t chunk_len,
+    size_t *out_offsets,
+    size_t out_capacity,
+    size_t *out_count
+);
+
+/* Reports whether the scanner currently sits inside a string token. */
+bool osd_json_scanner_in_string(const OSDJsonScanner *scanner);
+
+/* Names the compiled block classifier for diagnostics and benchmarks. */
+const char *osd_json_scanner_backend_name(void);
+
+#endif
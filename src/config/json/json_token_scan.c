@@ -1,8 +1,15 @@
 #include "config/json/json_token_scan_internal.h"
 
+#include "config/json/json_struct_scan_internal.h"
+
 #include <ctype.h>
 #include <string.h>
 
+/* Text is fed to the scanner in slices so short tokens stop early. */
+#define OSD_JSON_SCAN_CHUNK_BYTES 4096U
+/* Offset batch size; must hold at least one full scanner block. */
+#define OSD_JSON_SCAN_BATCH_OFFSETS 256U
+
 /* Skips whitespace between JSON tokens. */
 const char *osd_json_skip_whitespace(const char *text) {
   while (text != NULL && *text != '\0' && isspace((unsigned char)*text) != 0) {
@@ -17,45 +24,81 @@ bool osd_json_is_value_terminator(char ch) {
   return ch == ',' || ch == '}' || ch == ']' || ch == '\0';
 }
 
-/* Skips one JSON string token and stops after the closing quote. */
-const char *osd_json_skip_string_token(const char *cursor) {
-  bool escaped = false;
+/* Pull-style cursor over structural bytes emitted by the shared scanner. */
+typedef struct {
+  OSDJsonScanner scanner;
+  const char *base;
+  const char *chunk;
+  size_t chunk_len;
+  size_t chunk_done;
+  size_t count;
+  size_t index;
+  size_t offsets[OSD_JSON_SCAN_BATCH_OFFSETS];
+} OSDJsonStructuralCursor;
+
+static void osd_json_structural_cursor_init(OSDJsonStructuralCursor *cursor, const char *text) {
+  osd_json_scanner_init(&cursor->scanner);
+  cursor->base = text;
+  cursor->chunk = text;
+  cursor->chunk_len = 0U;
+  cursor->chunk_done = 0U;
+  cursor->count = 0U;
+  cursor->index = 0U;
+}
 
-  if (cursor == NULL || *cursor != '"') {
-    return NULL;
+/*
+ * Returns the next structural byte position, or NULL at end of text.
+ * Chunks are bounded by strnlen so a token near the start of a large buffer
+ * never pays for a full-length scan.
+ */
+static inline const char *osd_json_structural_next(OSDJsonStructuralCursor *cursor) {
+  while (cursor->index == cursor->count) {
+    if (cursor->chunk_done == cursor->chunk_len) {
+      cursor->chunk += cursor->chunk_len;
+      cursor->chunk_len = strnlen(cursor->chunk, OSD_JSON_SCAN_CHUNK_BYTES);
+      cursor->chunk_done = 0U;
+      if (cursor->chunk_len == 0U) {
+        /* End of text reached before the caller finished its token. */
+        return NULL;
+      }
+    }
+
+    cursor->count = 0U;
+    cursor->index = 0U;
+    cursor->chunk_done += osd_json_scanner_feed(&cursor->scanner, cursor->chunk + cursor->chunk_done,
+                                                cursor->chunk_len - cursor->chunk_done, cursor->offsets,
+                                                OSD_JSON_SCAN_BATCH_OFFSETS, &cursor->count);
   }
 
-  cursor++;
-  while (*cursor != '\0') {
-    if (!escaped && *cursor == '\\') {
-      /* Backslash escapes exactly one following character in JSON. */
-      escaped = true;
-      cursor++;
-      continue;
-    }
+  return cursor->base + cursor->offsets[cursor->index++];
+}
 
-    if (!escaped && *cursor == '"') {
-      /* Closing quote ends the current token. */
-      return cursor + 1;
-    }
+/* Skips one JSON string token and stops after the closing quote. */
+const char *osd_json_skip_string_token(const char *cursor) {
+  OSDJsonStructuralCursor structurals;
+  const char *closing = NULL;
 
-    /* Escape state is one-character wide and resets immediately. */
-    escaped = false;
-    cursor++;
+  if (cursor == NULL || *cursor != '"') {
+    return NULL;
   }
 
-  return NULL;
+  osd_json_structural_cursor_init(&structurals, cursor);
+  /* First structural is the opening quote itself. */
+  (void)osd_json_structural_next(&structurals);
+  /* Scanner reports nothing but the closing quote while inside a string. */
+  closing = osd_json_structural_next(&structurals);
+  return (closing == NULL) ? NULL : closing + 1;
 }
 
 /*
  * Skips one object or array token including nested structures.
- * Strings are tracked so braces inside string literals do not affect depth.
+ * The shared scanner masks braces inside string literals before depth tracking.
  */
 const char *osd_json_skip_container_token(const char *cursor) {
+  OSDJsonStructuralCursor structurals;
+  const char *structural = NULL;
   int brace_depth = 0;
   int bracket_depth = 0;
-  bool in_string = false;
-  bool escaped = false;
 
   if (cursor == NULL) {
     return NULL;
@@ -64,54 +107,35 @@ const char *osd_json_skip_container_token(const char *cursor) {
     return NULL;
   }
 
-  for (; *cursor != '\0'; cursor++) {
-    if (in_string) {
-      if (!escaped && *cursor == '\\') {
-        /* Escaped characters are ignored for structural parsing. */
-        escaped = true;
-        continue;
-      }
-      if (!escaped && *cursor == '"') {
-        /* Exit string mode once unescaped quote is observed. */
-        in_string = false;
-      }
-      escaped = false;
-      continue;
-    }
-
-    if (*cursor == '"') {
-      /* String mode shields braces/brackets from depth counters. */
-      in_string = true;
-      escaped = false;
-      continue;
-    }
-    if (*cursor == '{') {
+  osd_json_structural_cursor_init(&structurals, cursor);
+  while ((structural = osd_json_structural_next(&structurals)) != NULL) {
+    switch (*structural) {
+    case '{':
       /* Count nested objects to find the matching close brace. */
       brace_depth++;
       continue;
-    }
-    if (*cursor == '[') {
+    case '[':
       /* Arrays share the same balanced-container tracking. */
       bracket_depth++;
       continue;
-    }
-    if (*cursor == '}') {
+    case '}':
       brace_depth--;
-      if (brace_depth < 0) {
-        /* Negative depth means malformed container input. */
-        return NULL;
-      }
-    } else if (*cursor == ']') {
+      break;
+    case ']':
       bracket_depth--;
-      if (bracket_depth < 0) {
-        /* Negative depth means malformed container input. */
-        return NULL;
-      }
+      break;
+    default:
+      /* Quotes, colons, and commas never change container depth. */
+      continue;
     }
 
+    if (brace_depth < 0 || bracket_depth < 0) {
+      /* Negative depth means malformed container input. */
+      return NULL;
+    }
     if (brace_depth == 0 && bracket_depth == 0) {
       /* Both depths zero indicates container end was reached. */
-      return cursor + 1;
+      return structural + 1;
     }
   }
 
@@ -146,23 +170,3 @@ const char *osd_json_skip_value_token(const char *cursor) {
 
   return value_end;
 }
-
-/* Checks a key token and verifies the required ':' separator. */
-bool osd_json_match_key_at_cursor(const char *cursor, const char *key, size_t key_len) {
-  const char *after_key = NULL;
-
-  /* Key text must match exactly, including case and punctuation. */
-  if (strncmp(cursor, key, key_len) != 0) {
-    return false;
-  }
-
-  after_key = cursor + key_len;
-  if (*after_key != '"') {
-    /* Enforces full-key match rather than prefix-key match. */
-    return false;
-  }
-
-  /* Top-level object syntax requires a colon after key token. */
-  after_key = osd_json_skip_whitespace(after_key + 1);
-  return after_key != NULL && *after_key == ':';
-}
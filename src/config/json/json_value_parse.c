@@ -1,60 +1,112 @@
 #include "config/json/json_config_fields.h"
 #include "config/json/json_token_scan_internal.h"
 
+#include <ctype.h>
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
 
-/* Parses an integer key with strict token termination checks. */
-bool osd_config_parse_long_value(const char *json_text, const char *key, long *out_value) {
-  const char *value_start = osd_config_find_key(json_text, key);
-  const char *token_end = NULL;
+/* Checks that only whitespace separates a parsed token from its span end. */
+static bool osd_config_token_fills_span(const char *token_end, const OSDConfigValueSpan *span) {
+  while (token_end < span->end) {
+    if (isspace((unsigned char)*token_end) == 0) {
+      return false;
+    }
+    token_end++;
+  }
+  return token_end == span->end;
+}
+
+/* Parses an integer value span with strict token termination checks. */
+bool osd_config_parse_long_value(const OSDConfigValueSpan *span, long *out_value) {
   char *end_ptr = NULL;
+  long parsed = 0L;
 
-  if (value_start == NULL || out_value == NULL) {
+  if (span == NULL || span->start == NULL || out_value == NULL) {
     return false;
   }
 
   errno = 0;
   /* Base-10 parse only; locale-independent integer grammar is expected. */
-  *out_value = strtol(osd_json_skip_whitespace(value_start), &end_ptr, 10);
-  if (errno != 0 || end_ptr == NULL) {
+  parsed = strtol(span->start, &end_ptr, 10);
+  if (errno != 0 || end_ptr == NULL || end_ptr == span->start) {
     return false;
   }
-  if (end_ptr == osd_json_skip_whitespace(value_start)) {
+
+  /* Value token must consume the whole indexed span. */
+  if (!osd_config_token_fills_span(end_ptr, span)) {
     return false;
   }
 
-  /* Value token must end at a JSON separator. */
-  token_end = osd_json_skip_whitespace(end_ptr);
-  return token_end != NULL && osd_json_is_value_terminator(*token_end);
+  *out_value = parsed;
+  return true;
 }
 
-/* Parses a boolean key and validates that trailing bytes are separators. */
-bool osd_config_parse_bool_value(const char *json_text, const char *key, bool *out_value) {
-  const char *value_start = osd_json_skip_whitespace(osd_config_find_key(json_text, key));
-  const char *token_end = NULL;
+/* Parses a flat array of integers, rejecting more than max_values entries. */
+bool osd_config_parse_long_list_value(
+    const OSDConfigValueSpan *span,
+    long *out_values,
+    size_t max_values,
+    size_t *out_count
+) {
+  const char *cursor = NULL;
+  char *end_ptr = NULL;
+  size_t count = 0U;
 
-  if (value_start == NULL || out_value == NULL) {
+  if (span == NULL || span->start == NULL || out_values == NULL || out_count == NULL || *span->start != '[') {
     return false;
   }
 
-  if (strncmp(value_start, "true", 4) == 0) {
-    /* Boolean token requires separator after the literal text. */
-    token_end = osd_json_skip_whitespace(value_start + 4);
-    if (token_end == NULL || !osd_json_is_value_terminator(*token_end)) {
+  cursor = osd_json_skip_whitespace(span->start + 1);
+  if (cursor != NULL && *cursor == ']') {
+    *out_count = 0U;
+    return osd_config_token_fills_span(cursor + 1, span);
+  }
+
+  for (;;) {
+    if (cursor == NULL || cursor >= span->end || count >= max_values) {
+      return false;
+    }
+    errno = 0;
+    out_values[count] = strtol(cursor, &end_ptr, 10);
+    if (errno != 0 || end_ptr == NULL || end_ptr == cursor) {
+      return false;
+    }
+    count++;
+
+    /* Elements are separated by commas and the list closes with the span's bracket. */
+    cursor = osd_json_skip_whitespace(end_ptr);
+    if (cursor == NULL || cursor >= span->end) {
+      return false;
+    }
+    if (*cursor == ']') {
+      break;
+    }
+    if (*cursor != ',') {
       return false;
     }
+    cursor = osd_json_skip_whitespace(cursor + 1);
+  }
+
+  if (!osd_config_token_fills_span(cursor + 1, span)) {
+    return false;
+  }
+  *out_count = count;
+  return true;
+}
+
+/* Parses a boolean value span and validates that no trailing bytes remain. */
+bool osd_config_parse_bool_value(const OSDConfigValueSpan *span, bool *out_value) {
+  if (span == NULL || span->start == NULL || out_value == NULL) {
+    return false;
+  }
+
+  if (strncmp(span->start, "true", 4) == 0 && osd_config_token_fills_span(span->start + 4, span)) {
     *out_value = true;
     return true;
   }
 
-  if (strncmp(value_start, "false", 5) == 0) {
-    /* Boolean token requires separator after the literal text. */
-    token_end = osd_json_skip_whitespace(value_start + 5);
-    if (token_end == NULL || !osd_json_is_value_terminator(*token_end)) {
-      return false;
-    }
+  if (strncmp(span->start, "false", 5) == 0 && osd_config_token_fills_span(span->start + 5, span)) {
     *out_value = false;
     return true;
   }
@@ -63,48 +115,27 @@ bool osd_config_parse_bool_value(const char *json_text, const char *key, bool *o
 }
 
 /*
- * Parses a quoted JSON string value.
+ * Parses a quoted JSON string value span.
  * Escape sequences are preserved as raw bytes because CSS/path consumers parse
  * plain strings and this parser only validates boundaries and size.
  */
-bool osd_config_parse_string_value(const char *json_text, const char *key, char *out_buffer,
-                                   size_t out_size) {
-  const char *value_start = osd_json_skip_whitespace(osd_config_find_key(json_text, key));
-  const char *token_end = NULL;
+bool osd_config_parse_string_value(const OSDConfigValueSpan *span, char *out_buffer, size_t out_size) {
+  const char *value_start = NULL;
   size_t copy_len = 0U;
-  bool escaped = false;
 
-  if (value_start == NULL || out_buffer == NULL || out_size == 0U || *value_start != '"') {
+  if (span == NULL || span->start == NULL || out_buffer == NULL || out_size == 0U || *span->start != '"') {
     return false;
   }
 
-  /* Skip opening quote before scanning content bytes. */
-  value_start++;
-  while (value_start[copy_len] != '\0') {
-    if (!escaped && value_start[copy_len] == '\\') {
-      /* Escape applies to the next byte only. */
-      escaped = true;
-      copy_len++;
-      continue;
-    }
-
-    if (!escaped && value_start[copy_len] == '"') {
-      /* Closing quote found; copy length is finalized. */
-      break;
-    }
-
-    /* Escape flag resets after consuming one following byte. */
-    escaped = false;
-    copy_len++;
-  }
-
-  if (value_start[copy_len] != '"' || copy_len >= out_size) {
+  /* Index already located the closing quote, so the span bounds the content. */
+  if (osd_json_skip_string_token(span->start) != span->end) {
     return false;
   }
 
-  /* Ensure no unexpected trailing content after closing quote. */
-  token_end = osd_json_skip_whitespace(value_start + copy_len + 1U);
-  if (token_end == NULL || !osd_json_is_value_terminator(*token_end)) {
+  /* Content sits between the opening and closing quotes. */
+  value_start = span->start + 1;
+  copy_len = (size_t)(span->end - value_start) - 1U;
+  if (copy_len >= out_size) {
     return false;
   }
 
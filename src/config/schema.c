@@ -1,26 +1,19 @@
 #include "config/schema.h"
 
+#include "args/schema.h"
 #include "config/json/json_config_fields.h"
 
 #include <stddef.h>
 
-// Maintains the authoritative allowlist for top-level config keys
-static const char *const OSD_ALLOWED_KEYS[] = {"watch_mode",    "use_system_volume",
-                                               "enable_slide",  "css_file",
-                                               "css_replace",   "timeout_ms",
-                                               "watch_poll_ms", "monitor_index",
-                                               "anchor",        "x_percent",
-                                               "y_percent",     "margin_x",
-                                               "margin_y",      "width",
-                                               "height",        "vertical",
-                                               "radius",        "icon_size",
-                                               "font_size",     "background_color",
-                                               "border_color",  "fill_color",
-                                               "track_color",   "text_color",
-                                               "icon_color"};
+_Static_assert(OSD_SETTING_COUNT <= OSD_CONFIG_INDEX_MAX_KEYS, "setting schema exceeds config key index capacity");
 
-// Validates top-level keys against the schema allowlist
-bool osd_config_schema_validate_top_level_keys(const char *json_text, FILE *err_stream) {
-  return osd_config_validate_top_level_keys(
-      json_text, OSD_ALLOWED_KEYS, sizeof(OSD_ALLOWED_KEYS) / sizeof(OSD_ALLOWED_KEYS[0]), err_stream);
+// Resolves a top-level key through the shared settings schema
+static size_t osd_config_schema_lookup_key(const char *key) {
+  return (size_t)osd_schema_find_json_key(key);
+}
+
+// Validates the config envelope and indexes top-level keys by setting id
+bool osd_config_schema_build_index(const char *json_text, OSDConfigKeyIndex *out_index, FILE *err_stream) {
+  return osd_config_build_key_index(json_text, osd_config_schema_lookup_key, (size_t)OSD_SETTING_COUNT, out_index,
+                                    err_stream);
 }
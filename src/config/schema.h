@@ -1,9 +1,11 @@
 #ifndef HYPRVOLUME_CONFIG_SCHEMA_H
 #define HYPRVOLUME_CONFIG_SCHEMA_H
 
+#include "config/json/json_config_fields.h"
+
 #include <stdbool.h>
 #include <stdio.h>
 
-bool osd_config_schema_validate_top_level_keys(const char *json_text, FILE *err_stream);
+bool osd_config_schema_build_index(const char *json_text, OSDConfigKeyIndex *out_index, FILE *err_stream);
 
 #endif
@@ -2,9 +2,15 @@
 
 #include "style/style_custom.h"
 #include "style/style_icon.h"
+#include "style/style_paint.h"
 #include "style/style_theme.h"
 
-// Public facade delegates theme provider construction
+// Public facade delegates base stylesheet loading
+GtkCssProvider *osd_style_build_base_provider(void) {
+    return osd_style_theme_build_base_provider();
+}
+
+// Public facade delegates theme variables provider construction
 GtkCssProvider *osd_style_build_provider(const OSDTheme *theme) {
     return osd_style_theme_build_provider(theme);
 }
@@ -14,7 +20,30 @@ bool osd_style_build_custom_provider(const char *path, GtkCssProvider **out_prov
     return osd_style_custom_build_provider(path, out_provider, err_stream);
 }
 
+// Public facade delegates theme paint decoding
+bool osd_style_parse_paint(const char *text, OSDStylePaint *out_paint) {
+    return osd_style_paint_parse_internal(text, out_paint);
+}
+
+// Public facade delegates paint node emission
+void osd_style_append_paint(GtkSnapshot *snapshot, const OSDStylePaint *paint, const graphene_rect_t *bounds) {
+    osd_style_paint_append_internal(snapshot, paint, bounds);
+}
+
 // Public facade delegates icon mapping logic
 const char *osd_style_icon_name_for_state(const OSDVolumeState *state) {
     return osd_style_icon_name_for_state_internal(state);
 }
+
+// Public facade delegates icon bucket mapping
+OSDIconBucket osd_style_icon_bucket_for_state(const OSDVolumeState *state) {
+    return osd_style_icon_bucket_for_state_internal(state);
+}
+
+const char *osd_style_icon_name_for_bucket(OSDIconBucket bucket) {
+    return osd_style_icon_name_for_bucket_internal(bucket);
+}
+
+const char *osd_style_icon_resource_uri_for_bucket(OSDIconBucket bucket) {
+    return osd_style_icon_resource_uri_for_bucket_internal(bucket);
+}
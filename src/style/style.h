@@ -2,11 +2,18 @@
 #define HYPRVOLUME_STYLE_H
 
 #include "args/args.h"
+#include "style/style_icon.h"
+#include "style/style_paint.h"
+#include "style/style_theme.h"
 
 #include <gtk/gtk.h>
 #include <stdio.h>
 
-// Builds the base CSS provider from theme values
+// Builds the static base CSS provider whose rules read theme variables
+// Caller must release the returned provider with g_object_unref
+GtkCssProvider *osd_style_build_base_provider(void);
+
+// Builds the variables provider from theme values, a few hundred bytes to parse
 // Caller must release the returned provider with g_object_unref
 GtkCssProvider *osd_style_build_provider(const OSDTheme *theme);
 
@@ -15,8 +22,23 @@ GtkCssProvider *osd_style_build_provider(const OSDTheme *theme);
 // Caller must release *out_provider with g_object_unref on success
 bool osd_style_build_custom_provider(const char *path, GtkCssProvider **out_provider, FILE *err_stream);
 
+// Decodes a theme color or linear-gradient() value for snapshot drawing
+// Returns false for values only CSS can render
+bool osd_style_parse_paint(const char *text, OSDStylePaint *out_paint);
+
+// Draws decoded paint over bounds, clipped by whatever the caller pushed
+void osd_style_append_paint(GtkSnapshot *snapshot, const OSDStylePaint *paint, const graphene_rect_t *bounds);
+
 // Maps volume state to a symbolic icon name
 // Returned string has static lifetime
 const char *osd_style_icon_name_for_state(const OSDVolumeState *state);
 
+// Maps volume state to its icon bucket
+OSDIconBucket osd_style_icon_bucket_for_state(const OSDVolumeState *state);
+
+// Maps an icon bucket to its system theme name or bundled resource URI
+// Returned strings have static lifetime
+const char *osd_style_icon_name_for_bucket(OSDIconBucket bucket);
+const char *osd_style_icon_resource_uri_for_bucket(OSDIconBucket bucket);
+
 #endif
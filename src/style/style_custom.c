@@ -3,12 +3,14 @@
 #include "common/safeio.h"
 
 #include <errno.h>
+#include <fcntl.h>
 #include <glib.h>
 #include <stdio.h>
-#include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
+// Whole file is copied to the heap, so the cap bounds what a wrong css_path can cost
 #define OSD_CUSTOM_CSS_MAX_BYTES (256U * 1024U)
 
 typedef struct {
@@ -54,15 +56,49 @@ static void osd_style_on_parsing_error(
     (void)osd_io_write_line(context->err_stream, error->message);
 }
 
+// Reads exactly length bytes from the start of fd, false on error or when the file ended early
+// A copy instead of a mapping, since editors that rewrite in place can shrink the file under a reader
+// and touching mapped pages past the new end of file raises SIGBUS
+static bool osd_style_read_fd(int fd, char *buffer, size_t length, int *out_error_number) {
+    size_t offset = 0U;
+
+    *out_error_number = 0;
+    while (offset < length) {
+        const ssize_t read_count = read(fd, buffer + offset, length - offset);
+
+        if (read_count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (read_count < 0) {
+            *out_error_number = errno;
+            return false;
+        }
+        if (read_count == 0) {
+            return false;
+        }
+        offset += (size_t)read_count;
+    }
+    return true;
+}
+
+// Writes "<prefix><path>: <reason>" for failed file system calls
+static void osd_style_write_path_errno(FILE *err_stream, const char *prefix, const char *path, int error_number) {
+    (void)osd_io_write_text(err_stream, prefix);
+    (void)osd_io_write_text(err_stream, path);
+    (void)osd_io_write_text(err_stream, ": ");
+    (void)osd_io_write_line(err_stream, strerror(error_number));
+}
+
 bool osd_style_custom_build_provider(const char *path, GtkCssProvider **out_provider, FILE *err_stream) {
     struct stat file_stat;
-    FILE *css_file = NULL;
     char *css_text = NULL;
+    GBytes *css_bytes = NULL;
+    size_t css_length = 0U;
+    int read_error = 0;
     GtkCssProvider *provider = NULL;
     OSDCustomCssParseContext context;
     gulong handler_id = 0UL;
-    size_t file_size = 0U;
-    size_t bytes_read = 0U;
+    int fd = -1;
 
     if (path == NULL || out_provider == NULL || err_stream == NULL) {
         return false;
@@ -73,16 +109,22 @@ bool osd_style_custom_build_provider(const char *path, GtkCssProvider **out_prov
     }
     *out_provider = NULL;
 
-    if (stat(path, &file_stat) != 0) {
-        (void)osd_io_write_text(err_stream, "Failed to stat custom CSS file ");
-        (void)osd_io_write_text(err_stream, path);
-        (void)osd_io_write_text(err_stream, ": ");
-        (void)osd_io_write_line(err_stream, strerror(errno));
+    // Non-blocking open keeps a FIFO at the path from stalling before fstat rejects it
+    fd = open(path, O_RDONLY | O_CLOEXEC | O_NONBLOCK);
+    if (fd < 0) {
+        osd_style_write_path_errno(err_stream, "Failed to open custom CSS file ", path, errno);
+        return false;
+    }
+    // Every check below sees the same inode that gets read
+    if (fstat(fd, &file_stat) != 0) {
+        osd_style_write_path_errno(err_stream, "Failed to stat custom CSS file ", path, errno);
+        (void)close(fd);
         return false;
     }
     if (!S_ISREG(file_stat.st_mode)) {
         (void)osd_io_write_text(err_stream, "Custom CSS path is not a regular file: ");
         (void)osd_io_write_line(err_stream, path);
+        (void)close(fd);
         return false;
     }
     if (file_stat.st_size <= 0 || file_stat.st_size > (off_t)OSD_CUSTOM_CSS_MAX_BYTES) {
@@ -92,53 +134,46 @@ bool osd_style_custom_build_provider(const char *path, GtkCssProvider **out_prov
         (void)osd_io_write_long_long(err_stream, (long long)file_stat.st_size);
         (void)osd_io_write_text(err_stream, " for ");
         (void)osd_io_write_line(err_stream, path);
+        (void)close(fd);
         return false;
     }
 
-    file_size = (size_t)file_stat.st_size;
-    css_text = calloc(file_size + 1U, sizeof(char));
-    if (css_text == NULL) {
-        (void)osd_io_write_text(err_stream, "Failed to allocate memory for custom CSS file ");
-        (void)osd_io_write_line(err_stream, path);
+    css_length = (size_t)file_stat.st_size;
+    css_text = g_malloc(css_length);
+    if (!osd_style_read_fd(fd, css_text, css_length, &read_error)) {
+        if (read_error != 0) {
+            osd_style_write_path_errno(err_stream, "Failed to read custom CSS file ", path, read_error);
+        } else {
+            // Truncated between fstat and read, the write event that follows schedules another reload
+            (void)osd_io_write_text(err_stream, "Failed to fully read custom CSS file ");
+            (void)osd_io_write_line(err_stream, path);
+        }
+        g_free(css_text);
+        (void)close(fd);
         return false;
     }
+    (void)close(fd);
 
-    css_file = fopen(path, "rb");
-    if (css_file == NULL) {
-        (void)osd_io_write_text(err_stream, "Failed to open custom CSS file ");
-        (void)osd_io_write_text(err_stream, path);
-        (void)osd_io_write_text(err_stream, ": ");
-        (void)osd_io_write_line(err_stream, strerror(errno));
-        free(css_text);
-        return false;
-    }
-
-    bytes_read = fread(css_text, 1U, file_size, css_file);
-    (void)fclose(css_file);
-    if (bytes_read != file_size) {
-        (void)osd_io_write_text(err_stream, "Failed to fully read custom CSS file ");
-        (void)osd_io_write_line(err_stream, path);
-        free(css_text);
-        return false;
-    }
-
-    if (!g_utf8_validate(css_text, (gssize)file_size, NULL)) {
+    if (!g_utf8_validate(css_text, (gssize)css_length, NULL)) {
         (void)osd_io_write_text(err_stream, "Custom CSS file must be valid UTF-8: ");
         (void)osd_io_write_line(err_stream, path);
-        free(css_text);
+        g_free(css_text);
         return false;
     }
 
+    // Bytes take over the buffer and free it when GTK drops them
+    css_bytes = g_bytes_new_take(css_text, css_length);
+
     provider = gtk_css_provider_new();
     context.path = path;
     context.err_stream = err_stream;
     context.has_parsing_error = false;
     handler_id = g_signal_connect(provider, "parsing-error", G_CALLBACK(osd_style_on_parsing_error), &context);
-    gtk_css_provider_load_from_string(provider, css_text);
+    gtk_css_provider_load_from_bytes(provider, css_bytes);
     if (handler_id != 0UL) {
         g_signal_handler_disconnect(provider, handler_id);
     }
-    free(css_text);
+    g_bytes_unref(css_bytes);
 
     if (context.has_parsing_error) {
         g_object_unref(provider);
@@ -1,26 +1,63 @@
 #include "style/style_icon.h"
 
-// Maps runtime volume state to symbolic desktop icon names
-// Return values are static string literals and are never heap-allocated
-const char *osd_style_icon_name_for_state_internal(const OSDVolumeState *state) {
+#define OSD_ICON_RESOURCE_DIR "resource:///dev/hyprland/hyprvolume/icons/"
+
+static const char *const OSD_ICON_NAMES[OSD_ICON_BUCKET_COUNT] = {
+    "audio-volume-muted-symbolic",
+    "audio-volume-low-symbolic",
+    "audio-volume-medium-symbolic",
+    "audio-volume-high-symbolic"
+};
+
+// Bundled files keep the -symbolic suffix so GTK recolors them from CSS like theme icons
+static const char *const OSD_ICON_RESOURCE_URIS[OSD_ICON_BUCKET_COUNT] = {
+    OSD_ICON_RESOURCE_DIR "audio-volume-muted-symbolic.svg",
+    OSD_ICON_RESOURCE_DIR "audio-volume-low-symbolic.svg",
+    OSD_ICON_RESOURCE_DIR "audio-volume-medium-symbolic.svg",
+    OSD_ICON_RESOURCE_DIR "audio-volume-high-symbolic.svg"
+};
+
+// Maps runtime volume state to icon buckets
+OSDIconBucket osd_style_icon_bucket_for_state_internal(const OSDVolumeState *state) {
     // Null state falls back to muted icon for safe default rendering
     if (state == NULL) {
-        return "audio-volume-muted-symbolic";
+        return OSD_ICON_BUCKET_MUTED;
     }
 
     // Muted or zero volume uses muted icon regardless of bucket thresholds
     if (state->muted || state->volume_percent <= 0) {
-        return "audio-volume-muted-symbolic";
+        return OSD_ICON_BUCKET_MUTED;
     }
 
     // Buckets mirror common desktop volume icon transitions
     if (state->volume_percent < 34) {
-        return "audio-volume-low-symbolic";
+        return OSD_ICON_BUCKET_LOW;
     }
 
     if (state->volume_percent < 67) {
-        return "audio-volume-medium-symbolic";
+        return OSD_ICON_BUCKET_MEDIUM;
+    }
+
+    return OSD_ICON_BUCKET_HIGH;
+}
+
+// Return values are static string literals and are never heap-allocated
+const char *osd_style_icon_name_for_bucket_internal(OSDIconBucket bucket) {
+    if ((unsigned int)bucket >= (unsigned int)OSD_ICON_BUCKET_COUNT) {
+        return OSD_ICON_NAMES[OSD_ICON_BUCKET_MUTED];
     }
+    return OSD_ICON_NAMES[bucket];
+}
 
-    return "audio-volume-high-symbolic";
+const char *osd_style_icon_resource_uri_for_bucket_internal(OSDIconBucket bucket) {
+    if ((unsigned int)bucket >= (unsigned int)OSD_ICON_BUCKET_COUNT) {
+        return OSD_ICON_RESOURCE_URIS[OSD_ICON_BUCKET_MUTED];
+    }
+    return OSD_ICON_RESOURCE_URIS[bucket];
+}
+
+// Maps runtime volume state to symbolic desktop icon names
+// Return values are static string literals and are never heap-allocated
+const char *osd_style_icon_name_for_state_internal(const OSDVolumeState *state) {
+    return osd_style_icon_name_for_bucket_internal(osd_style_icon_bucket_for_state_internal(state));
 }
@@ -3,6 +3,21 @@
 
 #include "args/args.h"
 
+// Volume icon buckets shared by bundled and system icon rendering
+typedef enum {
+    OSD_ICON_BUCKET_MUTED = 0,
+    OSD_ICON_BUCKET_LOW = 1,
+    OSD_ICON_BUCKET_MEDIUM = 2,
+    OSD_ICON_BUCKET_HIGH = 3,
+    OSD_ICON_BUCKET_COUNT = 4
+} OSDIconBucket;
+
+// Maps normalized volume state to its icon bucket
+OSDIconBucket osd_style_icon_bucket_for_state_internal(const OSDVolumeState *state);
+// Maps a bucket to its symbolic icon name
+const char *osd_style_icon_name_for_bucket_internal(OSDIconBucket bucket);
+// Maps a bucket to the embedded resource URI of its bundled icon
+const char *osd_style_icon_resource_uri_for_bucket_internal(OSDIconBucket bucket);
 // Maps normalized volume state to symbolic icon name
 const char *osd_style_icon_name_for_state_internal(const OSDVolumeState *state);
 
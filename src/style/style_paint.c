@@ -0,0 +1,240 @@
+#include "style/style_paint.h"
+
+#include <math.h>
+#include <string.h>
+
+#define OSD_STYLE_PAINT_GRADIENT_PREFIX "linear-gradient("
+
+// Returns the first comma at parenthesis depth zero, or NULL when there is none
+static const char *osd_style_paint_find_separator(const char *start, const char *end) {
+    int depth = 0;
+
+    for (const char *cursor = start; cursor < end; cursor++) {
+        if (*cursor == '(') {
+            depth++;
+        } else if (*cursor == ')') {
+            depth--;
+        } else if (*cursor == ',' && depth == 0) {
+            return cursor;
+        }
+    }
+    return NULL;
+}
+
+// Narrows [start, end) to exclude surrounding ASCII whitespace
+static void osd_style_paint_trim(const char **start, const char **end) {
+    while (*start < *end && g_ascii_isspace(**start)) {
+        (*start)++;
+    }
+    while (*end > *start && g_ascii_isspace(*(*end - 1))) {
+        (*end)--;
+    }
+}
+
+// Parses a bare CSS color from a bounded span
+static bool osd_style_paint_parse_color(const char *start, const char *end, GdkRGBA *out_color) {
+    gchar *color_text = NULL;
+    bool ok = false;
+
+    osd_style_paint_trim(&start, &end);
+    if (start == end) {
+        return false;
+    }
+
+    color_text = g_strndup(start, (gsize)(end - start));
+    ok = gdk_rgba_parse(out_color, color_text);
+    g_free(color_text);
+    return ok;
+}
+
+// Parses "<angle>deg" or "to <side>" gradient direction
+static bool osd_style_paint_parse_direction(const char *start, const char *end, float *out_angle_deg) {
+    static const struct {
+        const char *keyword;
+        float angle_deg;
+    } OSD_SIDES[] = {{"to top", 0.0F}, {"to right", 90.0F}, {"to bottom", 180.0F}, {"to left", 270.0F}};
+    size_t length = 0U;
+    gchar *number_end = NULL;
+    double angle = 0.0;
+
+    osd_style_paint_trim(&start, &end);
+    length = (size_t)(end - start);
+
+    for (size_t index = 0U; index < G_N_ELEMENTS(OSD_SIDES); index++) {
+        if (strlen(OSD_SIDES[index].keyword) == length && strncmp(OSD_SIDES[index].keyword, start, length) == 0) {
+            *out_angle_deg = OSD_SIDES[index].angle_deg;
+            return true;
+        }
+    }
+
+    if (length <= 3U || strncmp(end - 3, "deg", 3U) != 0) {
+        return false;
+    }
+    angle = g_ascii_strtod(start, &number_end);
+    if (number_end != end - 3) {
+        return false;
+    }
+    *out_angle_deg = (float)angle;
+    return true;
+}
+
+// Parses "<color> [<percent>%]" and reports whether a position was present
+static bool osd_style_paint_parse_stop(
+    const char *start,
+    const char *end,
+    GskColorStop *out_stop,
+    bool *out_positioned
+) {
+    const char *position_start = NULL;
+    gchar *number_end = NULL;
+    double position = 0.0;
+
+    osd_style_paint_trim(&start, &end);
+    *out_positioned = false;
+
+    // Position is the last space separated token when it ends in '%' outside any function call
+    if (end > start && *(end - 1) == '%') {
+        position_start = end - 1;
+        while (position_start > start && !g_ascii_isspace(*(position_start - 1))) {
+            position_start--;
+        }
+        if (position_start > start) {
+            position = g_ascii_strtod(position_start, &number_end);
+            if (number_end != end - 1) {
+                return false;
+            }
+            *out_positioned = true;
+            out_stop->offset = (float)CLAMP(position / 100.0, 0.0, 1.0);
+            end = position_start;
+        }
+    }
+
+    return osd_style_paint_parse_color(start, end, &out_stop->color);
+}
+
+// Fills missing offsets the way CSS does: ends default to 0 and 1, gaps interpolate evenly
+static void osd_style_paint_resolve_offsets(OSDStylePaint *paint, const bool *positioned) {
+    size_t last_known = 0U;
+
+    if (!positioned[0]) {
+        paint->stops[0].offset = 0.0F;
+    }
+    if (!positioned[paint->stop_count - 1U]) {
+        paint->stops[paint->stop_count - 1U].offset = 1.0F;
+    }
+
+    for (size_t index = 1U; index < paint->stop_count; index++) {
+        if (!positioned[index] && index != paint->stop_count - 1U) {
+            continue;
+        }
+        for (size_t gap = last_known + 1U; gap < index; gap++) {
+            float span = paint->stops[index].offset - paint->stops[last_known].offset;
+            float step = (float)(gap - last_known) / (float)(index - last_known);
+            paint->stops[gap].offset = paint->stops[last_known].offset + span * step;
+        }
+        // Offsets never move backwards
+        if (paint->stops[index].offset < paint->stops[last_known].offset) {
+            paint->stops[index].offset = paint->stops[last_known].offset;
+        }
+        last_known = index;
+    }
+}
+
+bool osd_style_paint_parse_internal(const char *text, OSDStylePaint *out_paint) {
+    const size_t prefix_length = strlen(OSD_STYLE_PAINT_GRADIENT_PREFIX);
+    bool positioned[OSD_STYLE_PAINT_MAX_STOPS];
+    const char *start = NULL;
+    const char *end = NULL;
+    const char *separator = NULL;
+    OSDStylePaint paint;
+
+    if (text == NULL || out_paint == NULL) {
+        return false;
+    }
+
+    memset(&paint, 0, sizeof(paint));
+    start = text;
+    end = text + strlen(text);
+    osd_style_paint_trim(&start, &end);
+
+    if ((size_t)(end - start) <= prefix_length || strncmp(start, OSD_STYLE_PAINT_GRADIENT_PREFIX, prefix_length) != 0) {
+        // Plain color paints as a single stop
+        if (!osd_style_paint_parse_color(start, end, &paint.stops[0].color)) {
+            return false;
+        }
+        paint.stop_count = 1U;
+        *out_paint = paint;
+        return true;
+    }
+
+    if (*(end - 1) != ')') {
+        return false;
+    }
+    start += prefix_length;
+    end--;
+
+    // CSS default direction is top to bottom
+    paint.angle_deg = 180.0F;
+    separator = osd_style_paint_find_separator(start, end);
+    if (separator != NULL && osd_style_paint_parse_direction(start, separator, &paint.angle_deg)) {
+        start = separator + 1;
+    }
+
+    while (start < end) {
+        separator = osd_style_paint_find_separator(start, end);
+        if (paint.stop_count == OSD_STYLE_PAINT_MAX_STOPS) {
+            return false;
+        }
+        if (!osd_style_paint_parse_stop(
+                start,
+                (separator != NULL) ? separator : end,
+                &paint.stops[paint.stop_count],
+                &positioned[paint.stop_count]
+            )) {
+            return false;
+        }
+        paint.stop_count++;
+        start = (separator != NULL) ? separator + 1 : end;
+    }
+
+    // CSS requires at least two stops in a gradient
+    if (paint.stop_count < 2U) {
+        return false;
+    }
+
+    osd_style_paint_resolve_offsets(&paint, positioned);
+    *out_paint = paint;
+    return true;
+}
+
+// Emits one color node or one linear gradient node covering bounds
+void osd_style_paint_append_internal(
+    GtkSnapshot *snapshot,
+    const OSDStylePaint *paint,
+    const graphene_rect_t *bounds
+) {
+    graphene_point_t start_point;
+    graphene_point_t end_point;
+    float radians = 0.0F;
+    float direction_x = 0.0F;
+    float direction_y = 0.0F;
+    float half_length = 0.0F;
+    float center_x = 0.0F;
+    float center_y = 0.0F;
+
+    if (paint->stop_count == 1U) {
+        gtk_snapshot_append_color(snapshot, &paint->stops[0].color, bounds);
+        return;
+    }
+
+    // CSS gradient line passes through the center and spans the box corners along the angle
+    radians = paint->angle_deg * (float)G_PI / 180.0F;
+    direction_x = sinf(radians);
+    direction_y = -cosf(radians);
+    half_length = (fabsf(bounds->size.width * direction_x) + fabsf(bounds->size.height * direction_y)) / 2.0F;
+    center_x = bounds->origin.x + bounds->size.width / 2.0F;
+    center_y = bounds->origin.y + bounds->size.height / 2.0F;
+    graphene_point_init(&start_point, center_x - direction_x * half_length, center_y - direction_y * half_length);
+    graphene_point_init(&end_point, center_x + direction_x * half_length, center_y + direction_y * half_length);
+    gtk_snapshot_append_linear_gradient(snapshot, bounds, &start_point, &end_point, paint->stops, paint->stop_count);
+}
@@ -0,0 +1,28 @@
+#ifndef HYPRVOLUME_STYLE_PAINT_H
+#define HYPRVOLUME_STYLE_PAINT_H
+
+#include <gtk/gtk.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Upper bound for gradient stops accepted from theme values
+#define OSD_STYLE_PAINT_MAX_STOPS 8U
+
+// Solid color or linear gradient decoded from a theme CSS value
+typedef struct {
+    // Gradient direction in CSS degrees, 0 points up and 90 points right
+    float angle_deg;
+    // One stop means a solid color
+    size_t stop_count;
+    // Stops with offsets resolved to [0, 1]
+    GskColorStop stops[OSD_STYLE_PAINT_MAX_STOPS];
+} OSDStylePaint;
+
+// Decodes a CSS color or linear-gradient() value into paint data for snapshot nodes
+// Returns false for anything else so callers can fall back to CSS rendering
+bool osd_style_paint_parse_internal(const char *text, OSDStylePaint *out_paint);
+
+// Emits one color node or one linear gradient node covering bounds
+void osd_style_paint_append_internal(GtkSnapshot *snapshot, const OSDStylePaint *paint, const graphene_rect_t *bounds);
+
+#endif
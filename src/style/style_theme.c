@@ -2,6 +2,13 @@
 
 #include <glib.h>
 
+// CSS custom properties and var() landed in GTK 4.16
+#if !GTK_CHECK_VERSION(4, 16, 0)
+#error "HyprVolume theme variables require GTK 4.16 or newer"
+#endif
+
+#define OSD_STYLE_THEME_BASE_RESOURCE "/dev/hyprland/hyprvolume/theme/base.css"
+
 // Derives theme-dependent pixel dimensions used by generated CSS
 static void compute_theme_geometry(
     const OSDTheme *theme,
@@ -28,6 +35,14 @@ static void compute_theme_geometry(
     *slash_font_px = theme->icon_size_px + 2U;
 }
 
+GtkCssProvider *osd_style_theme_build_base_provider(void) {
+    GtkCssProvider *provider = gtk_css_provider_new();
+
+    // Static sheet is parsed once per process straight from the embedded resource
+    gtk_css_provider_load_from_resource(provider, OSD_STYLE_THEME_BASE_RESOURCE);
+    return provider;
+}
+
 GtkCssProvider *osd_style_theme_build_provider(const OSDTheme *theme) {
     GtkCssProvider *provider = NULL;
     gchar *css = NULL;
@@ -50,87 +65,28 @@ GtkCssProvider *osd_style_theme_build_provider(const OSDTheme *theme) {
         &slash_font_px
     );
 
+    // Custom properties inherit, so defining them on the window root reaches every OSD widget
     css = g_strdup_printf(
         ".osd-window {"
-        "  background-color: transparent;"
-        "  outline: none;"
-        "}"
-        ".osd-card {"
-        "  min-width: %upx;"
-        "  min-height: %upx;"
-        "  padding: 7px 11px;"
-        "  border-radius: %upx;"
-        "  border: 1px solid %s;"
-        "  background: %s;"
-        "  box-shadow: 0 6px 18px rgba(7, 12, 22, 0.62);"
-        "}"
-        ".osd-icon-wrap {"
-        "  min-width: %upx;"
-        "  min-height: %upx;"
-        "  margin-right: 10px;"
-        "  border-radius: 7px;"
-        "  background: linear-gradient(180deg, rgba(26, 37, 58, 0.98), rgba(20, 30, 46, 0.98));"
-        "}"
-        ".osd-icon {"
-        "  color: %s;"
-        "}"
-        ".osd-icon-slash {"
-        "  color: #ff4757;"
-        "  font-size: %upx;"
-        "  font-weight: 900;"
-        "  line-height: 1;"
-        "  margin-left: 1px;"
-        "  margin-top: -1px;"
-        "}"
-        ".osd-bar {"
-        "  min-width: %upx;"
-        "  min-height: 11px;"
-        "}"
-        ".osd-bar trough {"
-        "  min-height: 8px;"
-        "  border-radius: 999px;"
-        "  background: %s;"
-        "  border: 1px solid rgba(95, 123, 169, 0.48);"
-        "}"
-        ".osd-bar progress {"
-        "  min-height: 8px;"
-        "  border-radius: 999px;"
-        "  background: %s;"
-        "}"
-        ".osd-percent {"
-        "  color: %s;"
-        "  margin-left: 10px;"
-        "  min-width: 42px;"
-        "  font-size: %upx;"
-        "  font-weight: 800;"
-        "  letter-spacing: 0.2px;"
-        "}"
-        ".osd-percent.muted {"
-        "  color: #d53a4f;"
-        "}"
-        ".osd-card.vertical {"
-        "  padding: 10px 8px;"
-        "}"
-        ".osd-icon-wrap.vertical {"
-        "  margin-right: 0;"
-        "  margin-bottom: 9px;"
-        "}"
-        ".osd-bar.vertical {"
-        "  min-width: %upx;"
-        "  min-height: %upx;"
-        "}"
-        ".osd-bar.vertical trough {"
-        "  min-width: %upx;"
-        "  min-height: %upx;"
-        "}"
-        ".osd-bar.vertical progress {"
-        "  min-width: %upx;"
-        "  min-height: 0;"
-        "}"
-        ".osd-percent.vertical {"
-        "  margin-left: 0;"
-        "  margin-top: 9px;"
-        "  min-width: 0;"
+        "  --osd-width: %upx;"
+        "  --osd-height: %upx;"
+        "  --osd-radius: %upx;"
+        "  --osd-border-color: %s;"
+        "  --osd-background-color: %s;"
+        "  --osd-icon-wrap-size: %upx;"
+        "  --osd-icon-color: %s;"
+        "  --osd-slash-font-size: %upx;"
+        "  --osd-bar-width: %upx;"
+        "  --osd-track-color: %s;"
+        "  --osd-fill-color: %s;"
+        "  --osd-text-color: %s;"
+        "  --osd-font-size: %upx;"
+        "  --osd-vertical-bar-width: %upx;"
+        "  --osd-vertical-bar-height: %upx;"
+        "  --osd-card-shadow: 0 %upx %upx %s;"
+        "  --osd-icon-wrap-radius: %upx;"
+        "  --osd-icon-wrap-background: %s;"
+        "  --osd-track-border-color: %s;"
         "}",
         theme->width_px,
         theme->height_px,
@@ -138,7 +94,6 @@ GtkCssProvider *osd_style_theme_build_provider(const OSDTheme *theme) {
         theme->border_color,
         theme->background_color,
         icon_wrap_px,
-        icon_wrap_px,
         theme->icon_color,
         slash_font_px,
         bar_width_px,
@@ -148,9 +103,12 @@ GtkCssProvider *osd_style_theme_build_provider(const OSDTheme *theme) {
         theme->font_size_px,
         vertical_bar_width_px,
         vertical_bar_height_px,
-        vertical_bar_width_px,
-        vertical_bar_height_px,
-        vertical_bar_width_px
+        OSD_STYLE_THEME_CARD_SHADOW_OFFSET_Y_PX,
+        OSD_STYLE_THEME_CARD_SHADOW_BLUR_PX,
+        OSD_STYLE_THEME_CARD_SHADOW_COLOR,
+        OSD_STYLE_THEME_ICON_WRAP_RADIUS_PX,
+        OSD_STYLE_THEME_ICON_WRAP_BACKGROUND,
+        OSD_STYLE_THEME_TRACK_BORDER_COLOR
     );
     if (css == NULL) {
         return NULL;
@@ -5,7 +5,20 @@
 
 #include <gtk/gtk.h>
 
-// Builds provider from runtime theme values
+// Fixed parts of the built-in look, emitted as theme variables for the base sheet
+// The prerendered card and volume bar decode the same values, so both paths draw from one definition
+#define OSD_STYLE_THEME_CARD_SHADOW_OFFSET_Y_PX 6U
+#define OSD_STYLE_THEME_CARD_SHADOW_BLUR_PX 18U
+#define OSD_STYLE_THEME_CARD_SHADOW_COLOR "rgba(7, 12, 22, 0.62)"
+#define OSD_STYLE_THEME_ICON_WRAP_RADIUS_PX 7U
+#define OSD_STYLE_THEME_ICON_WRAP_BACKGROUND \
+    "linear-gradient(180deg, rgba(26, 37, 58, 0.98), rgba(20, 30, 46, 0.98))"
+#define OSD_STYLE_THEME_TRACK_BORDER_COLOR "rgba(95, 123, 169, 0.48)"
+
+// Builds the static base stylesheet provider from the embedded resource
+GtkCssProvider *osd_style_theme_build_base_provider(void);
+
+// Builds the small provider that only defines theme CSS variables
 GtkCssProvider *osd_style_theme_build_provider(const OSDTheme *theme);
 
 #endif
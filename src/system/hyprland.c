@@ -0,0 +1,449 @@
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "system/hyprland.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#define OSD_HYPRLAND_READ_CHUNK 256U
+// A j/monitors reply runs about 1.5 KiB per output, anything past this is dropped from the seed
+#define OSD_HYPRLAND_REPLY_MAX (64U * 1024U)
+// Bounds the one blocking request on the main loop when the compositor is wedged
+#define OSD_HYPRLAND_REQUEST_TIMEOUT_MS 250
+
+// Builds a socket path under the session's Hyprland instance directory
+static bool build_socket_path(const char *socket_name, char *out_path, size_t out_size) {
+  const char *runtime_dir = getenv("XDG_RUNTIME_DIR");
+  const char *signature = getenv("HYPRLAND_INSTANCE_SIGNATURE");
+  int written = 0;
+
+  if (runtime_dir == NULL || runtime_dir[0] == '\0' || signature == NULL || signature[0] == '\0') {
+    return false;
+  }
+  // The signature is one path component, anything else is not a Hyprland session we understand
+  if (strchr(signature, '/') != NULL) {
+    return false;
+  }
+
+  written = snprintf(out_path, out_size, "%s/hypr/%s/%s", runtime_dir, signature, socket_name);
+  return written > 0 && (size_t)written < out_size;
+}
+
+// Connects a blocking close-on-exec stream socket, -1 outside Hyprland or when the socket is unreachable
+static int connect_socket(const char *socket_name) {
+  struct sockaddr_un address;
+  int fd = -1;
+
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  if (!build_socket_path(socket_name, address.sun_path, sizeof(address.sun_path))) {
+    return -1;
+  }
+
+  fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd < 0) {
+    return -1;
+  }
+  if (connect(fd, (const struct sockaddr *)&address, (socklen_t)sizeof(address)) != 0) {
+    (void)close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+int osd_hyprland_open_event_socket(void) {
+  int fd = connect_socket(".socket2.sock");
+  int flags = 0;
+
+  if (fd < 0) {
+    return -1;
+  }
+
+  // Local connects complete immediately, so only the reads afterwards need to be nonblocking
+  flags = fcntl(fd, F_GETFL);
+  if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) != 0) {
+    (void)close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+// Matches "<event>>>" exactly, so focusedmon does not also match focusedmonv2, and returns the data after it
+static const char *event_data(const char *line, const char *event) {
+  const size_t event_length = strlen(event);
+
+  if (strncmp(line, event, event_length) != 0 || strncmp(line + event_length, ">>", 2U) != 0) {
+    return NULL;
+  }
+  return line + event_length + 2U;
+}
+
+// Copies length bytes as a string, false when they do not fit or are empty
+static bool copy_field(const char *start, size_t length, char *out, size_t out_size) {
+  if (length == 0U || length >= out_size) {
+    return false;
+  }
+  memcpy(out, start, length);
+  out[length] = '\0';
+  return true;
+}
+
+static OSDHyprlandMonitor *find_monitor(OSDHyprlandState *state, const char *name) {
+  for (size_t index = 0U; index < state->monitor_count; index++) {
+    if (strcmp(state->monitors[index].name, name) == 0) {
+      return &state->monitors[index];
+    }
+  }
+  return NULL;
+}
+
+// Records the active workspace of one output, silently dropping outputs past the table size
+static void set_monitor_workspace(OSDHyprlandState *state, const char *monitor, const char *workspace) {
+  OSDHyprlandMonitor *entry = find_monitor(state, monitor);
+
+  if (entry == NULL) {
+    if (state->monitor_count >= OSD_HYPRLAND_MONITOR_MAX) {
+      return;
+    }
+    entry = &state->monitors[state->monitor_count];
+    if (!copy_field(monitor, strlen(monitor), entry->name, sizeof(entry->name))) {
+      return;
+    }
+    state->monitor_count++;
+  }
+  (void)snprintf(entry->workspace, sizeof(entry->workspace), "%s", workspace);
+}
+
+static size_t find_fullscreen(const OSDHyprlandState *state, const char *workspace) {
+  for (size_t index = 0U; index < state->fullscreen_count; index++) {
+    if (strcmp(state->fullscreen_workspaces[index], workspace) == 0) {
+      return index;
+    }
+  }
+  return state->fullscreen_count;
+}
+
+// Returns OSD_HYPRLAND_CHANGE_FULLSCREEN only when the stored flag actually flipped
+static unsigned int set_workspace_fullscreen(OSDHyprlandState *state, const char *workspace, bool fullscreen) {
+  size_t index = 0U;
+
+  // A fullscreen event before any workspace is known cannot be tied to an output, so it is not recorded
+  if (workspace[0] == '\0') {
+    return OSD_HYPRLAND_CHANGE_NONE;
+  }
+  index = find_fullscreen(state, workspace);
+  if (fullscreen) {
+    if (index < state->fullscreen_count || state->fullscreen_count >= OSD_HYPRLAND_FULLSCREEN_MAX) {
+      return OSD_HYPRLAND_CHANGE_NONE;
+    }
+    (void)snprintf(state->fullscreen_workspaces[state->fullscreen_count], OSD_HYPRLAND_WORKSPACE_NAME_MAX, "%s",
+                   workspace);
+    state->fullscreen_count++;
+    return OSD_HYPRLAND_CHANGE_FULLSCREEN;
+  }
+
+  if (index == state->fullscreen_count) {
+    return OSD_HYPRLAND_CHANGE_NONE;
+  }
+  // Order is irrelevant, so the last entry fills the gap
+  state->fullscreen_count--;
+  if (index != state->fullscreen_count) {
+    memcpy(state->fullscreen_workspaces[index], state->fullscreen_workspaces[state->fullscreen_count],
+           OSD_HYPRLAND_WORKSPACE_NAME_MAX);
+  }
+  return OSD_HYPRLAND_CHANGE_FULLSCREEN;
+}
+
+// focusedmon>>MONITOR,WORKSPACE, the v2 spelling carries a workspace id that the other events never use
+static unsigned int apply_focused_monitor(OSDHyprlandState *state, const char *data, bool has_workspace_name) {
+  const char *comma = strchr(data, ',');
+  char monitor[OSD_HYPRLAND_MONITOR_NAME_MAX];
+  unsigned int changes = OSD_HYPRLAND_CHANGE_NONE;
+
+  if (comma == NULL || !copy_field(data, (size_t)(comma - data), monitor, sizeof(monitor))) {
+    return OSD_HYPRLAND_CHANGE_NONE;
+  }
+
+  if (strcmp(monitor, state->focused_monitor) != 0) {
+    memcpy(state->focused_monitor, monitor, sizeof(monitor));
+    changes |= OSD_HYPRLAND_CHANGE_FOCUS;
+  }
+  if (has_workspace_name && comma[1] != '\0') {
+    (void)snprintf(state->focused_workspace, sizeof(state->focused_workspace), "%s", comma + 1);
+    set_monitor_workspace(state, monitor, state->focused_workspace);
+    changes |= OSD_HYPRLAND_CHANGE_FULLSCREEN;
+  }
+  return changes;
+}
+
+unsigned int osd_hyprland_apply_event(OSDHyprlandState *state, const char *line) {
+  const char *data = NULL;
+
+  if (state == NULL || line == NULL) {
+    return OSD_HYPRLAND_CHANGE_NONE;
+  }
+
+  if ((data = event_data(line, "focusedmon")) != NULL) {
+    return apply_focused_monitor(state, data, true);
+  }
+  if ((data = event_data(line, "focusedmonv2")) != NULL) {
+    return apply_focused_monitor(state, data, false);
+  }
+  if ((data = event_data(line, "workspace")) != NULL) {
+    // Workspace switches happen on the focused monitor
+    if (data[0] == '\0') {
+      return OSD_HYPRLAND_CHANGE_NONE;
+    }
+    (void)snprintf(state->focused_workspace, sizeof(state->focused_workspace), "%s", data);
+    if (state->focused_monitor[0] != '\0') {
+      set_monitor_workspace(state, state->focused_monitor, state->focused_workspace);
+    }
+    return OSD_HYPRLAND_CHANGE_FULLSCREEN;
+  }
+  if ((data = event_data(line, "fullscreen")) != NULL) {
+    // The event describes the active window, which lives on the focused workspace
+    return set_workspace_fullscreen(state, state->focused_workspace, strcmp(data, "1") == 0);
+  }
+  if ((data = event_data(line, "activewindow")) != NULL) {
+    // No active window at all means nothing on the focused workspace can be fullscreen
+    if (strcmp(data, ",") == 0) {
+      return set_workspace_fullscreen(state, state->focused_workspace, false);
+    }
+    return OSD_HYPRLAND_CHANGE_NONE;
+  }
+  if ((data = event_data(line, "destroyworkspace")) != NULL) {
+    return set_workspace_fullscreen(state, data, false);
+  }
+  return OSD_HYPRLAND_CHANGE_NONE;
+}
+
+bool osd_hyprland_monitor_is_fullscreen(const OSDHyprlandState *state, const char *monitor) {
+  const char *workspace = NULL;
+
+  if (state == NULL) {
+    return false;
+  }
+
+  if (monitor != NULL) {
+    for (size_t index = 0U; index < state->monitor_count; index++) {
+      if (strcmp(state->monitors[index].name, monitor) == 0) {
+        workspace = state->monitors[index].workspace;
+        break;
+      }
+    }
+    if (workspace == NULL && strcmp(state->focused_monitor, monitor) != 0) {
+      // An output never seen active is not the one the fullscreen events talked about, nor is any named output
+      // while focus is still unknown
+      return false;
+    }
+  }
+  if (workspace == NULL) {
+    workspace = state->focused_workspace;
+  }
+  return find_fullscreen(state, workspace) < state->fullscreen_count;
+}
+
+// Copies the string body starting after its opening quote into out, truncating to empty when it does not fit
+// Returns the position after the closing quote, or NULL for an unterminated string
+static const char *read_json_string(const char *cursor, char *out, size_t out_size) {
+  size_t used = 0U;
+  bool fits = true;
+
+  while (*cursor != '"') {
+    if (*cursor == '\0') {
+      return NULL;
+    }
+    if (*cursor == '\\' && cursor[1] != '\0') {
+      // Escapes never occur in connector or workspace names Hyprland would match, so they only need skipping
+      cursor++;
+    }
+    if (used + 1U < out_size) {
+      out[used] = *cursor;
+      used++;
+    } else {
+      fits = false;
+    }
+    cursor++;
+  }
+  out[fits ? used : 0U] = '\0';
+  return cursor + 1;
+}
+
+// Walks a j/monitors reply, an array of outputs each with a name, an activeWorkspace object, and a focused flag
+// Only object nesting, strings, and that flag are tracked, every other value is skipped character by character
+static void apply_monitors_reply(OSDHyprlandState *state, const char *reply) {
+  const char *cursor = reply;
+  unsigned int depth = 0U;
+  bool in_active_workspace = false;
+  bool focused = false;
+  char key[OSD_HYPRLAND_WORKSPACE_NAME_MAX] = "";
+  char monitor[OSD_HYPRLAND_MONITOR_NAME_MAX] = "";
+  char workspace[OSD_HYPRLAND_WORKSPACE_NAME_MAX] = "";
+
+  while (*cursor != '\0') {
+    if (*cursor == '"') {
+      char text[OSD_HYPRLAND_WORKSPACE_NAME_MAX];
+
+      cursor = read_json_string(cursor + 1, text, sizeof(text));
+      if (cursor == NULL) {
+        return;
+      }
+      while (*cursor == ' ' || *cursor == '\t' || *cursor == '\n' || *cursor == '\r') {
+        cursor++;
+      }
+      if (*cursor == ':') {
+        (void)snprintf(key, sizeof(key), "%s", text);
+        cursor++;
+        continue;
+      }
+      if (depth == 1U && strcmp(key, "name") == 0) {
+        (void)snprintf(monitor, sizeof(monitor), "%s", text);
+      } else if (depth == 2U && in_active_workspace && strcmp(key, "name") == 0) {
+        (void)snprintf(workspace, sizeof(workspace), "%s", text);
+      }
+      key[0] = '\0';
+      continue;
+    }
+
+    if (*cursor == '{') {
+      depth++;
+      if (depth == 1U) {
+        monitor[0] = '\0';
+        workspace[0] = '\0';
+        focused = false;
+      }
+      in_active_workspace = depth == 2U && strcmp(key, "activeWorkspace") == 0;
+      key[0] = '\0';
+    } else if (*cursor == '}' && depth > 0U) {
+      if (depth == 1U && monitor[0] != '\0' && workspace[0] != '\0') {
+        set_monitor_workspace(state, monitor, workspace);
+        if (focused) {
+          memcpy(state->focused_monitor, monitor, sizeof(monitor));
+          memcpy(state->focused_workspace, workspace, sizeof(workspace));
+        }
+      }
+      in_active_workspace = false;
+      depth--;
+    } else if (*cursor == ',') {
+      key[0] = '\0';
+    } else if (depth == 1U && strcmp(key, "focused") == 0 && strncmp(cursor, "true", 4U) == 0) {
+      focused = true;
+    }
+    cursor++;
+  }
+}
+
+bool osd_hyprland_seed_state(OSDHyprlandState *state) {
+  static const char request[] = "j/monitors";
+  const struct timeval timeout = {0, OSD_HYPRLAND_REQUEST_TIMEOUT_MS * 1000};
+  char *reply = NULL;
+  size_t used = 0U;
+  int fd = -1;
+
+  if (state == NULL) {
+    return false;
+  }
+
+  fd = connect_socket(".socket.sock");
+  if (fd < 0) {
+    return false;
+  }
+  if (setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, (socklen_t)sizeof(timeout)) != 0 ||
+      setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, (socklen_t)sizeof(timeout)) != 0 ||
+      write(fd, request, sizeof(request) - 1U) != (ssize_t)(sizeof(request) - 1U)) {
+    (void)close(fd);
+    return false;
+  }
+
+  reply = malloc(OSD_HYPRLAND_REPLY_MAX + 1U);
+  if (reply == NULL) {
+    (void)close(fd);
+    return false;
+  }
+  // Hyprland closes the command socket after one reply, so end of stream ends the read
+  while (used < OSD_HYPRLAND_REPLY_MAX) {
+    const ssize_t read_count = read(fd, reply + used, OSD_HYPRLAND_REPLY_MAX - used);
+
+    if (read_count < 0 && errno == EINTR) {
+      continue;
+    }
+    if (read_count <= 0) {
+      break;
+    }
+    used += (size_t)read_count;
+  }
+  (void)close(fd);
+  reply[used] = '\0';
+
+  apply_monitors_reply(state, reply);
+  free(reply);
+  return state->focused_monitor[0] != '\0';
+}
+
+// Feeds raw socket bytes through the line buffer and applies each completed line
+static unsigned int consume_event_bytes(OSDHyprlandEventBuffer *buffer, const char *bytes, size_t length,
+                                        OSDHyprlandState *state) {
+  unsigned int changes = OSD_HYPRLAND_CHANGE_NONE;
+
+  for (size_t index = 0U; index < length; index++) {
+    const char byte = bytes[index];
+
+    if (byte == '\n') {
+      if (!buffer->discarding) {
+        buffer->line[buffer->used] = '\0';
+        changes |= osd_hyprland_apply_event(state, buffer->line);
+      }
+      buffer->used = 0U;
+      buffer->discarding = false;
+      continue;
+    }
+    if (buffer->discarding) {
+      continue;
+    }
+    if (buffer->used + 1U >= sizeof(buffer->line)) {
+      // Followed events are short, so an overlong line is some other event and is dropped whole
+      buffer->used = 0U;
+      buffer->discarding = true;
+      continue;
+    }
+    buffer->line[buffer->used] = byte;
+    buffer->used++;
+  }
+  return changes;
+}
+
+OSDHyprlandReadStatus osd_hyprland_read_events(int fd, OSDHyprlandEventBuffer *buffer, OSDHyprlandState *state,
+                                               unsigned int *out_changes) {
+  char chunk[OSD_HYPRLAND_READ_CHUNK];
+
+  if (fd < 0 || buffer == NULL || state == NULL || out_changes == NULL) {
+    return OSD_HYPRLAND_READ_CLOSED;
+  }
+  *out_changes = OSD_HYPRLAND_CHANGE_NONE;
+
+  for (;;) {
+    const ssize_t read_count = read(fd, chunk, sizeof(chunk));
+
+    if (read_count > 0) {
+      *out_changes |= consume_event_bytes(buffer, chunk, (size_t)read_count, state);
+      continue;
+    }
+    if (read_count < 0 && errno == EINTR) {
+      continue;
+    }
+    if (read_count == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+      // Zero means Hyprland went away, anything else is an unrecoverable socket error
+      return OSD_HYPRLAND_READ_CLOSED;
+    }
+    return OSD_HYPRLAND_READ_OK;
+  }
+}
@@ -0,0 +1,81 @@
+#ifndef HYPRVOLUME_SYSTEM_HYPRLAND_H
+#define HYPRVOLUME_SYSTEM_HYPRLAND_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Hyprland output names are connector names such as DP-1 or HDMI-A-2
+#define OSD_HYPRLAND_MONITOR_NAME_MAX 64U
+#define OSD_HYPRLAND_WORKSPACE_NAME_MAX 64U
+// Outputs whose active workspace is followed, later ones fall back to the focused workspace
+#define OSD_HYPRLAND_MONITOR_MAX 16U
+// Workspaces remembered as holding a fullscreen client, later ones are treated as not fullscreen
+#define OSD_HYPRLAND_FULLSCREEN_MAX 32U
+// Longest event line kept, longer ones such as activewindow with huge titles are skipped whole
+#define OSD_HYPRLAND_EVENT_LINE_MAX 512U
+
+typedef enum {
+  // Socket drained and still connected
+  OSD_HYPRLAND_READ_OK = 0,
+  // Hyprland closed the socket or the read failed, the caller should drop the descriptor
+  OSD_HYPRLAND_READ_CLOSED
+} OSDHyprlandReadStatus;
+
+// What an event batch changed, as bits
+typedef enum {
+  OSD_HYPRLAND_CHANGE_NONE = 0U,
+  // Another monitor received focus
+  OSD_HYPRLAND_CHANGE_FOCUS = 1U << 0U,
+  // A workspace gained or lost its fullscreen client, or a monitor switched workspaces
+  OSD_HYPRLAND_CHANGE_FULLSCREEN = 1U << 1U
+} OSDHyprlandChange;
+
+// Partial event line carried between reads of the event socket
+typedef struct {
+  char line[OSD_HYPRLAND_EVENT_LINE_MAX];
+  size_t used;
+  // Set while the rest of an overlong line is being dropped
+  bool discarding;
+} OSDHyprlandEventBuffer;
+
+// Active workspace last reported for one output
+typedef struct {
+  char name[OSD_HYPRLAND_MONITOR_NAME_MAX];
+  char workspace[OSD_HYPRLAND_WORKSPACE_NAME_MAX];
+} OSDHyprlandMonitor;
+
+// Compositor state learned from events since the socket was opened
+// Focus and active workspaces can be seeded from the command socket, fullscreen clients start out unknown
+typedef struct {
+  // Connector name of the focused monitor, empty until seeded or the first focusedmon event
+  char focused_monitor[OSD_HYPRLAND_MONITOR_NAME_MAX];
+  // Workspace that fullscreen events apply to, empty until seeded or the first workspace event
+  char focused_workspace[OSD_HYPRLAND_WORKSPACE_NAME_MAX];
+  OSDHyprlandMonitor monitors[OSD_HYPRLAND_MONITOR_MAX];
+  size_t monitor_count;
+  char fullscreen_workspaces[OSD_HYPRLAND_FULLSCREEN_MAX][OSD_HYPRLAND_WORKSPACE_NAME_MAX];
+  size_t fullscreen_count;
+} OSDHyprlandState;
+
+// Connects to $XDG_RUNTIME_DIR/hypr/$HYPRLAND_INSTANCE_SIGNATURE/.socket2.sock
+// Returns a nonblocking close-on-exec descriptor, or -1 outside Hyprland or when the socket is unreachable
+int osd_hyprland_open_event_socket(void);
+
+// Fills in the focused monitor and every output's active workspace from one j/monitors request on .socket.sock
+// Returns false when the command socket is unreachable or the reply named no focused output
+bool osd_hyprland_seed_state(OSDHyprlandState *state);
+
+// Applies one event line without its newline and returns OSDHyprlandChange bits
+// Follows focusedmon, workspace, fullscreen, activewindow, and destroyworkspace, and ignores every other event
+unsigned int osd_hyprland_apply_event(OSDHyprlandState *state, const char *line);
+
+// Reports whether the active workspace of monitor holds a fullscreen client
+// A NULL monitor or the focused one uses the focused workspace, other unknown names and unknown focus report false
+bool osd_hyprland_monitor_is_fullscreen(const OSDHyprlandState *state, const char *monitor);
+
+// Reads everything currently available on the event socket into state
+// out_changes collects the OSDHyprlandChange bits of every applied event
+OSDHyprlandReadStatus osd_hyprland_read_events(int fd, OSDHyprlandEventBuffer *buffer, OSDHyprlandState *state,
+                                               unsigned int *out_changes);
+
+#endif
@@ -0,0 +1,140 @@
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "system/resource.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define OSD_RESOURCE_LINE_MAX 256U
+
+// Reads the Rss line from smaps_rollup which already sums all mappings
+long long osd_system_resource_sample_rss_kib(void) {
+  FILE *rollup_file = NULL;
+  char line[OSD_RESOURCE_LINE_MAX];
+  long long rss_kib = -1LL;
+
+  rollup_file = fopen("/proc/self/smaps_rollup", "r");
+  if (rollup_file == NULL) {
+    return -1LL;
+  }
+
+  while (fgets(line, (int)sizeof(line), rollup_file) != NULL) {
+    char *end_ptr = NULL;
+    long long parsed = 0LL;
+
+    if (strncmp(line, "Rss:", 4U) != 0) {
+      continue;
+    }
+
+    // Kernel format is "Rss:   <value> kB" with base-10 value
+    errno = 0;
+    parsed = strtoll(line + 4, &end_ptr, 10);
+    if (errno == 0 && end_ptr != line + 4 && parsed >= 0LL) {
+      rss_kib = parsed;
+    }
+    break;
+  }
+
+  (void)fclose(rollup_file);
+  return rss_kib;
+}
+
+// Counts descriptor entries and excludes the directory stream used for counting
+static long long sample_open_fds(void) {
+  DIR *fd_dir = NULL;
+  struct dirent *entry = NULL;
+  long long count = 0LL;
+
+  fd_dir = opendir("/proc/self/fd");
+  if (fd_dir == NULL) {
+    return -1LL;
+  }
+
+  while ((entry = readdir(fd_dir)) != NULL) {
+    if (entry->d_name[0] == '.') {
+      continue;
+    }
+    count++;
+  }
+
+  (void)closedir(fd_dir);
+  // opendir holds one descriptor while the scan is running
+  return (count > 0LL) ? count - 1LL : 0LL;
+}
+
+// Checks one /proc/<pid>/stat record for parent pid and zombie state
+static bool stat_is_zombie_child(const char *pid_text, pid_t parent_pid) {
+  char path[64];
+  char line[OSD_RESOURCE_LINE_MAX];
+  FILE *stat_file = NULL;
+  const char *cursor = NULL;
+  char state = '\0';
+  long ppid = 0L;
+  int written = 0;
+
+  written = snprintf(path, sizeof(path), "/proc/%s/stat", pid_text);
+  if (written < 0 || (size_t)written >= sizeof(path)) {
+    return false;
+  }
+
+  stat_file = fopen(path, "r");
+  if (stat_file == NULL) {
+    // Processes can exit between readdir and open
+    return false;
+  }
+  if (fgets(line, (int)sizeof(line), stat_file) == NULL) {
+    (void)fclose(stat_file);
+    return false;
+  }
+  (void)fclose(stat_file);
+
+  // comm may contain spaces and ')' so fields start after the last ')'
+  cursor = strrchr(line, ')');
+  if (cursor == NULL || sscanf(cursor + 1, " %c %ld", &state, &ppid) != 2) {
+    return false;
+  }
+
+  return state == 'Z' && ppid == (long)parent_pid;
+}
+
+// Scans procfs for direct children that exited but were never reaped
+static long long sample_zombie_children(void) {
+  DIR *proc_dir = NULL;
+  struct dirent *entry = NULL;
+  pid_t self_pid = getpid();
+  long long count = 0LL;
+
+  proc_dir = opendir("/proc");
+  if (proc_dir == NULL) {
+    return -1LL;
+  }
+
+  while ((entry = readdir(proc_dir)) != NULL) {
+    if (entry->d_name[0] < '1' || entry->d_name[0] > '9') {
+      continue;
+    }
+    if (stat_is_zombie_child(entry->d_name, self_pid)) {
+      count++;
+    }
+  }
+
+  (void)closedir(proc_dir);
+  return count;
+}
+
+bool osd_system_resource_sample(OSDResourceUsage *out_usage) {
+  if (out_usage == NULL) {
+    return false;
+  }
+
+  out_usage->rss_kib = osd_system_resource_sample_rss_kib();
+  out_usage->open_fds = sample_open_fds();
+  out_usage->zombie_children = sample_zombie_children();
+  return true;
+}
@@ -0,0 +1,25 @@
+#ifndef HYPRVOLUME_SYSTEM_RESOURCE_H
+#define HYPRVOLUME_SYSTEM_RESOURCE_H
+
+#include <stdbool.h>
+
+// Process resource snapshot used by long-running watch diagnostics
+typedef struct {
+  // Resident set size in KiB from /proc/self/smaps_rollup, -1 when unavailable
+  long long rss_kib;
+  // Open descriptor count from /proc/self/fd, -1 when unavailable
+  long long open_fds;
+  // Direct children stuck in zombie state, -1 when unavailable
+  long long zombie_children;
+} OSDResourceUsage;
+
+// Samples current process resources from procfs
+// Each field is filled independently so one missing source does not hide the others
+// Returns false only when out_usage is null
+bool osd_system_resource_sample(OSDResourceUsage *out_usage);
+
+// Samples only the resident set size in KiB, -1 when unavailable
+// Skips the descriptor count and the procfs scan for zombies, for callers that sample around one operation
+long long osd_system_resource_sample_rss_kib(void);
+
+#endif
@@ -0,0 +1,132 @@
+#include "internal.h"
+
+#include "window/volume_bar.h"
+
+// Long enough to read as motion, short enough that a held volume key never trails behind
+#define WINDOW_BAR_ANIMATION_US 120000
+// Frame budget when neither the frame clock nor the monitor knows its refresh rate
+#define WINDOW_BAR_FALLBACK_BUDGET_US 16667
+
+// Writes a fraction into whichever bar widget the view was built with
+static void window_bar_apply_fraction(WindowView *view, double fraction) {
+    if (WINDOW_IS_VOLUME_BAR(view->progress_bar)) {
+        window_volume_bar_set_fraction(WINDOW_VOLUME_BAR(view->progress_bar), fraction);
+    } else {
+        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(view->progress_bar), fraction);
+    }
+    view->bar_animation.shown = fraction;
+}
+
+// One refresh interval of the output the view presents on
+static gint64 window_bar_frame_budget_us(const WindowView *view, GdkFrameClock *clock) {
+    gint64 refresh_interval_us = 0;
+    int refresh_rate_mhz = 0;
+
+    gdk_frame_clock_get_refresh_info(clock, gdk_frame_clock_get_frame_time(clock), &refresh_interval_us, NULL);
+    if (refresh_interval_us > 0) {
+        return refresh_interval_us;
+    }
+    if (view->monitor != NULL) {
+        refresh_rate_mhz = gdk_monitor_get_refresh_rate(view->monitor);
+    }
+    if (refresh_rate_mhz > 0) {
+        return (gint64)1000000000 / (gint64)refresh_rate_mhz;
+    }
+    return WINDOW_BAR_FALLBACK_BUDGET_US;
+}
+
+// Ease out cubic, fast at first so the bar reacts on the very next frame
+static double window_bar_ease(double progress) {
+    const double remaining = 1.0 - progress;
+
+    return 1.0 - remaining * remaining * remaining;
+}
+
+static WindowView *window_bar_find_view(const WindowState *state, const GtkWidget *widget) {
+    for (unsigned int index = 0U; index < state->view_count; index++) {
+        if (state->views[index]->progress_bar == widget) {
+            return state->views[index];
+        }
+    }
+    return NULL;
+}
+
+// Runs once per frame of the view's frame clock, so the bar never updates faster than the output refreshes
+// Samples landing between frames only move the target, and the frame draws wherever the curve is by then
+static gboolean window_bar_on_tick(GtkWidget *widget, GdkFrameClock *clock, gpointer user_data) {
+    WindowState *state = user_data;
+    WindowView *view = window_bar_find_view(state, widget);
+    WindowBarAnimation *animation = NULL;
+    const gint64 frame_us = gdk_frame_clock_get_frame_time(clock);
+    gint64 budget_us = 0;
+    double progress = 1.0;
+
+    if (view == NULL) {
+        return G_SOURCE_REMOVE;
+    }
+    animation = &view->bar_animation;
+    budget_us = window_bar_frame_budget_us(view, clock);
+
+    if (animation->started_us == 0) {
+        // Segments start on the first frame that can present them, not when the sample arrived
+        animation->started_us = frame_us;
+    }
+    if (animation->last_frame_us > 0 && frame_us - animation->last_frame_us > budget_us + budget_us / 2) {
+        // Refresh cycles that passed without a tick of ours
+        state->stats.animation_missed_frames +=
+            (guint64)((frame_us - animation->last_frame_us + budget_us / 2) / budget_us - 1);
+    }
+    animation->last_frame_us = frame_us;
+
+    if (frame_us - animation->started_us < WINDOW_BAR_ANIMATION_US) {
+        progress = (double)(frame_us - animation->started_us) / (double)WINDOW_BAR_ANIMATION_US;
+    }
+    window_bar_apply_fraction(
+        view,
+        animation->start + (animation->target - animation->start) * window_bar_ease(progress)
+    );
+    state->stats.animation_frames++;
+    state->stats.animation_budget_us = budget_us;
+    state->stats.frame_animating = true;
+
+    if (progress < 1.0) {
+        return G_SOURCE_CONTINUE;
+    }
+    // Settled bars drop the callback, so an idle popup causes no frame clock wakeups
+    animation->tick_id = 0U;
+    return G_SOURCE_REMOVE;
+}
+
+void window_bar_animation_stop(WindowView *view) {
+    if (view->bar_animation.tick_id != 0U && view->progress_bar != NULL) {
+        gtk_widget_remove_tick_callback(view->progress_bar, view->bar_animation.tick_id);
+    }
+    view->bar_animation.tick_id = 0U;
+}
+
+void window_bar_animation_set(WindowState *state, WindowView *view, double fraction, bool animate) {
+    WindowBarAnimation *animation = &view->bar_animation;
+    gboolean animations_enabled = TRUE;
+
+    if (animate) {
+        // The desktop wide reduced motion switch also covers this bar
+        g_object_get(gtk_widget_get_settings(view->progress_bar), "gtk-enable-animations", &animations_enabled, NULL);
+    }
+    if (!animate || !animations_enabled || !gtk_widget_get_mapped(view->progress_bar)) {
+        window_bar_animation_stop(view);
+        animation->target = fraction;
+        window_bar_apply_fraction(view, fraction);
+        return;
+    }
+
+    if (animation->tick_id != 0U) {
+        state->stats.animation_retargets++;
+    } else {
+        animation->last_frame_us = 0;
+        animation->tick_id = gtk_widget_add_tick_callback(view->progress_bar, window_bar_on_tick, state, NULL);
+    }
+    // A new segment starts from wherever the bar is drawn now, so retargets never jump
+    animation->start = animation->shown;
+    animation->target = fraction;
+    animation->started_us = 0;
+}
@@ -0,0 +1,276 @@
+#include "window/card.h"
+
+#include <math.h>
+
+// Card outline from the base theme
+#define WINDOW_CARD_BORDER_PX 1.0F
+
+struct _WindowCard {
+    GtkBox parent_instance;
+    OSDStylePaint background_paint;
+    // Every background stop has full alpha, so the inside of the rounded shape covers what lies behind
+    bool background_opaque;
+    OSDStylePaint icon_wrap_paint;
+    bool has_icon_wrap_paint;
+    GdkRGBA shadow_color;
+    GdkRGBA border_color;
+    float radius_px;
+    // Child widget, owned by the box
+    GtkWidget *icon_wrap;
+    // Texture node reused for every frame until one of the keys below changes
+    GskRenderNode *decoration_node;
+    float cached_width;
+    float cached_height;
+    double cached_scale;
+    graphene_rect_t cached_icon_wrap_rect;
+};
+
+G_DEFINE_FINAL_TYPE(WindowCard, window_card, GTK_TYPE_BOX)
+
+static bool window_card_paint_is_opaque(const OSDStylePaint *paint) {
+    for (size_t index = 0U; index < paint->stop_count; index++) {
+        if (paint->stops[index].color.alpha < 1.0F) {
+            return false;
+        }
+    }
+    return paint->stop_count > 0U;
+}
+
+static void window_card_drop_decoration(WindowCard *self) {
+    g_clear_pointer(&self->decoration_node, gsk_render_node_unref);
+}
+
+// Records the same nodes the CSS theme produced for the card and icon tile
+static GskRenderNode *window_card_build_decoration(
+    WindowCard *self,
+    const graphene_rect_t *card_rect,
+    const graphene_rect_t *icon_wrap_rect
+) {
+    const float border_widths[4] = {
+        WINDOW_CARD_BORDER_PX,
+        WINDOW_CARD_BORDER_PX,
+        WINDOW_CARD_BORDER_PX,
+        WINDOW_CARD_BORDER_PX
+    };
+    const GdkRGBA border_colors[4] = {self->border_color, self->border_color, self->border_color, self->border_color};
+    GtkSnapshot *snapshot = gtk_snapshot_new();
+    GskRoundedRect card_shape;
+    GskRoundedRect icon_wrap_shape;
+
+    // Normalizing shrinks oversized radii the way CSS border-radius does
+    gsk_rounded_rect_init_from_rect(&card_shape, card_rect, self->radius_px);
+    gsk_rounded_rect_normalize(&card_shape);
+
+    gtk_snapshot_append_outset_shadow(
+        snapshot,
+        &card_shape,
+        &self->shadow_color,
+        0.0F,
+        (float)OSD_STYLE_THEME_CARD_SHADOW_OFFSET_Y_PX,
+        0.0F,
+        (float)OSD_STYLE_THEME_CARD_SHADOW_BLUR_PX
+    );
+    gtk_snapshot_push_rounded_clip(snapshot, &card_shape);
+    osd_style_append_paint(snapshot, &self->background_paint, card_rect);
+    gtk_snapshot_pop(snapshot);
+    gtk_snapshot_append_border(snapshot, &card_shape, border_widths, border_colors);
+
+    if (self->has_icon_wrap_paint && icon_wrap_rect->size.width > 0.0F && icon_wrap_rect->size.height > 0.0F) {
+        gsk_rounded_rect_init_from_rect(&icon_wrap_shape, icon_wrap_rect, (float)OSD_STYLE_THEME_ICON_WRAP_RADIUS_PX);
+        gsk_rounded_rect_normalize(&icon_wrap_shape);
+        gtk_snapshot_push_rounded_clip(snapshot, &icon_wrap_shape);
+        osd_style_append_paint(snapshot, &self->icon_wrap_paint, icon_wrap_rect);
+        gtk_snapshot_pop(snapshot);
+    }
+
+    return gtk_snapshot_free_to_node(snapshot);
+}
+
+// Renders decoration once at device scale and wraps the result in a texture node
+// Without a renderer the vector nodes are kept, which still skips rebuilding them per frame
+static GskRenderNode *window_card_rasterize(GtkWidget *widget, GskRenderNode *node, double scale) {
+    GtkNative *native = gtk_widget_get_native(widget);
+    GskRenderer *renderer = NULL;
+    GskTransform *transform = NULL;
+    GskRenderNode *scaled_node = NULL;
+    GskRenderNode *texture_node = NULL;
+    GdkTexture *texture = NULL;
+    graphene_rect_t bounds;
+    graphene_rect_t viewport;
+
+    if (native != NULL) {
+        renderer = gtk_native_get_renderer(native);
+    }
+    if (renderer == NULL || node == NULL) {
+        return node;
+    }
+
+    // Whole device pixels on both sides keep the blit free of resampling
+    gsk_render_node_get_bounds(node, &bounds);
+    graphene_rect_scale(&bounds, (float)scale, (float)scale, &viewport);
+    graphene_rect_round_extents(&viewport, &viewport);
+    graphene_rect_scale(&viewport, (float)(1.0 / scale), (float)(1.0 / scale), &bounds);
+
+    transform = gsk_transform_scale(NULL, (float)scale, (float)scale);
+    scaled_node = gsk_transform_node_new(node, transform);
+    gsk_transform_unref(transform);
+    texture = gsk_renderer_render_texture(renderer, scaled_node, &viewport);
+    gsk_render_node_unref(scaled_node);
+    gsk_render_node_unref(node);
+    if (texture == NULL) {
+        return NULL;
+    }
+
+    texture_node = gsk_texture_node_new(texture, &bounds);
+    g_object_unref(texture);
+    return texture_node;
+}
+
+static double window_card_scale(GtkWidget *widget) {
+    GtkNative *native = gtk_widget_get_native(widget);
+    GdkSurface *surface = NULL;
+
+    if (native != NULL) {
+        surface = gtk_native_get_surface(native);
+    }
+    if (surface != NULL) {
+        // Fractional scale so the texture matches device pixels exactly
+        return gdk_surface_get_scale(surface);
+    }
+    return (double)gtk_widget_get_scale_factor(widget);
+}
+
+static void window_card_snapshot(GtkWidget *widget, GtkSnapshot *snapshot) {
+    WindowCard *self = WINDOW_CARD(widget);
+    const float width = (float)gtk_widget_get_width(widget);
+    const float height = (float)gtk_widget_get_height(widget);
+    const double scale = window_card_scale(widget);
+    graphene_rect_t card_rect;
+    graphene_rect_t icon_wrap_rect;
+
+    graphene_rect_init(&icon_wrap_rect, 0.0F, 0.0F, 0.0F, 0.0F);
+    if (self->icon_wrap != NULL && gtk_widget_get_visible(self->icon_wrap) &&
+        !gtk_widget_compute_bounds(self->icon_wrap, widget, &icon_wrap_rect)) {
+        graphene_rect_init(&icon_wrap_rect, 0.0F, 0.0F, 0.0F, 0.0F);
+    }
+
+    if (width > 0.0F && height > 0.0F) {
+        // Value changes only redraw children, so the same node pointer is handed back and diffs as unchanged
+        if (self->decoration_node == NULL || self->cached_width != width || self->cached_height != height ||
+            self->cached_scale != scale || !graphene_rect_equal(&self->cached_icon_wrap_rect, &icon_wrap_rect)) {
+            window_card_drop_decoration(self);
+            graphene_rect_init(&card_rect, 0.0F, 0.0F, width, height);
+            self->decoration_node = window_card_rasterize(
+                widget,
+                window_card_build_decoration(self, &card_rect, &icon_wrap_rect),
+                scale
+            );
+            self->cached_width = width;
+            self->cached_height = height;
+            self->cached_scale = scale;
+            self->cached_icon_wrap_rect = icon_wrap_rect;
+        }
+        if (self->decoration_node != NULL) {
+            gtk_snapshot_append_node(snapshot, self->decoration_node);
+        }
+    }
+
+    GTK_WIDGET_CLASS(window_card_parent_class)->snapshot(widget, snapshot);
+}
+
+// Textures belong to the renderer of the surface they were drawn for
+static void window_card_unrealize(GtkWidget *widget) {
+    window_card_drop_decoration(WINDOW_CARD(widget));
+    GTK_WIDGET_CLASS(window_card_parent_class)->unrealize(widget);
+}
+
+static void window_card_dispose(GObject *object) {
+    WindowCard *self = WINDOW_CARD(object);
+
+    window_card_drop_decoration(self);
+    self->icon_wrap = NULL;
+    G_OBJECT_CLASS(window_card_parent_class)->dispose(object);
+}
+
+static void window_card_class_init(WindowCardClass *klass) {
+    GObjectClass *object_class = G_OBJECT_CLASS(klass);
+    GtkWidgetClass *widget_class = GTK_WIDGET_CLASS(klass);
+
+    object_class->dispose = window_card_dispose;
+    widget_class->snapshot = window_card_snapshot;
+    widget_class->unrealize = window_card_unrealize;
+    // Keeps the GtkBox node name so box selectors in user sheets still match
+    gtk_widget_class_set_css_name(widget_class, "box");
+}
+
+static void window_card_init(WindowCard *self) {
+    OSDStylePaint shadow_paint;
+
+    self->icon_wrap = NULL;
+    self->background_opaque = false;
+    self->decoration_node = NULL;
+    // Tile and shadow paints are the fixed theme values the base sheet reads, parsed once per card
+    self->has_icon_wrap_paint = osd_style_parse_paint(OSD_STYLE_THEME_ICON_WRAP_BACKGROUND, &self->icon_wrap_paint);
+    self->shadow_color = (GdkRGBA){0.0F, 0.0F, 0.0F, 0.0F};
+    if (osd_style_parse_paint(OSD_STYLE_THEME_CARD_SHADOW_COLOR, &shadow_paint) && shadow_paint.stop_count == 1U) {
+        self->shadow_color = shadow_paint.stops[0].color;
+    }
+    // Tells the base sheet to skip the CSS drawn versions of this decoration
+    gtk_widget_add_css_class(GTK_WIDGET(self), "prerendered");
+}
+
+GtkWidget *window_card_new(
+    GtkOrientation orientation,
+    const OSDStylePaint *background_paint,
+    const OSDStylePaint *border_paint,
+    unsigned int radius_px
+) {
+    WindowCard *self = NULL;
+
+    g_return_val_if_fail(background_paint != NULL, NULL);
+    g_return_val_if_fail(border_paint != NULL && border_paint->stop_count == 1U, NULL);
+
+    self = g_object_new(WINDOW_TYPE_CARD, "orientation", orientation, "spacing", 0, NULL);
+    self->background_paint = *background_paint;
+    self->background_opaque = window_card_paint_is_opaque(background_paint);
+    self->border_color = border_paint->stops[0].color;
+    self->radius_px = (float)radius_px;
+    return GTK_WIDGET(self);
+}
+
+void window_card_set_icon_wrap(WindowCard *self, GtkWidget *icon_wrap) {
+    g_return_if_fail(WINDOW_IS_CARD(self));
+
+    self->icon_wrap = icon_wrap;
+    window_card_drop_decoration(self);
+    gtk_widget_queue_draw(GTK_WIDGET(self));
+}
+
+bool window_card_get_opaque_rect(WindowCard *self, graphene_rect_t *out_rect) {
+    float width = 0.0F;
+    float height = 0.0F;
+    float radius = 0.0F;
+    graphene_rect_t wide_band;
+    graphene_rect_t tall_band;
+
+    g_return_val_if_fail(WINDOW_IS_CARD(self), false);
+    g_return_val_if_fail(out_rect != NULL, false);
+
+    width = (float)gtk_widget_get_width(GTK_WIDGET(self));
+    height = (float)gtk_widget_get_height(GTK_WIDGET(self));
+    // Translucent content, including the zero opacity of a keep-mapped hide, must never claim opacity
+    if (!self->background_opaque || gtk_widget_get_opacity(GTK_WIDGET(self)) < 1.0 || width <= 0.0F ||
+        height <= 0.0F) {
+        return false;
+    }
+
+    // Same clamp as the normalized shape, and the border is drawn over the opaque fill so it needs no inset
+    radius = fminf(self->radius_px, fminf(width, height) / 2.0F);
+    // Largest axis aligned rect clear of the corners is one of the two bands between them
+    graphene_rect_init(&wide_band, 0.0F, radius, width, height - 2.0F * radius);
+    graphene_rect_init(&tall_band, radius, 0.0F, width - 2.0F * radius, height);
+    *out_rect = (wide_band.size.width * wide_band.size.height >= tall_band.size.width * tall_band.size.height)
+                    ? wide_band
+                    : tall_band;
+    return out_rect->size.width > 0.0F && out_rect->size.height > 0.0F;
+}
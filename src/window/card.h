@@ -0,0 +1,26 @@
+#ifndef WINDOW_CARD_H
+#define WINDOW_CARD_H
+
+#include "style/style.h"
+
+#include <gtk/gtk.h>
+
+// Box whose shadow, background, border, and icon tile are rasterized once per size and scale
+#define WINDOW_TYPE_CARD (window_card_get_type())
+G_DECLARE_FINAL_TYPE(WindowCard, window_card, WINDOW, CARD, GtkBox)
+
+// Creates a card painting decoration from decoded theme values
+// border_paint must be a solid color
+GtkWidget *window_card_new(
+    GtkOrientation orientation,
+    const OSDStylePaint *background_paint,
+    const OSDStylePaint *border_paint,
+    unsigned int radius_px
+);
+// Marks the child whose tile background is baked into the card decoration
+void window_card_set_icon_wrap(WindowCard *self, GtkWidget *icon_wrap);
+// Stores the largest rect in card coordinates that the decoration paints fully opaque
+// Returns false for a translucent background or while the card is faded out
+bool window_card_get_opaque_rect(WindowCard *self, graphene_rect_t *out_rect);
+
+#endif
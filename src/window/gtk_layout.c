@@ -40,6 +40,62 @@ static GdkMonitor *window_get_target_monitor(int monitor_index) {
     return GDK_MONITOR(g_list_model_get_item(monitors, selected_index));
 }
 
+unsigned int window_resolve_monitors(const WindowState *state, GdkMonitor **out_monitors) {
+    const OSDMonitorSelection *selection = &state->args.monitors;
+    GdkDisplay *display = gdk_display_get_default();
+    GListModel *monitors = NULL;
+    guint monitor_count = 0U;
+    unsigned int view_count = 0U;
+    int fallback_index = -1;
+
+    if (display != NULL) {
+        monitors = gdk_display_get_monitors(display);
+        monitor_count = g_list_model_get_n_items(monitors);
+    }
+
+    if (selection->focused) {
+        // Unpinned layer surfaces land on the focused output anyway, so an unknown focus needs no guess
+        out_monitors[0] = window_focus_lookup_monitor(state);
+        return 1U;
+    }
+
+    if (selection->all && monitor_count > 0U) {
+        if (monitor_count > WINDOW_MAX_VIEWS) {
+            g_warning("%u monitors connected; showing the popup on the first %u", monitor_count, WINDOW_MAX_VIEWS);
+            monitor_count = WINDOW_MAX_VIEWS;
+        }
+        for (guint index = 0U; index < monitor_count; index++) {
+            out_monitors[view_count] = GDK_MONITOR(g_list_model_get_item(monitors, index));
+            view_count++;
+        }
+        return view_count;
+    }
+
+    if (selection->count > 1U) {
+        // Lists skip absent monitors so unplugging one screen leaves the others alone
+        for (unsigned int position = 0U; position < selection->count; position++) {
+            const guint monitor_index = (guint)selection->indices[position];
+
+            if (monitor_index >= monitor_count) {
+                g_warning("Listed monitor index %u is not connected; skipping it", monitor_index);
+                continue;
+            }
+            out_monitors[view_count] = GDK_MONITOR(g_list_model_get_item(monitors, monitor_index));
+            view_count++;
+        }
+        if (view_count > 0U) {
+            return view_count;
+        }
+    }
+
+    // Single index, or "all" or a list with nothing connected, keeps the one window fallback
+    if (!selection->all && selection->count == 1U) {
+        fallback_index = selection->indices[0];
+    }
+    out_monitors[0] = window_get_target_monitor(fallback_index);
+    return 1U;
+}
+
 // Converts 0..100 placement percentages into edge margins
 static int window_percent_to_margin(int percent, int monitor_size, unsigned int widget_size) {
     int available = monitor_size - (int)widget_size;
@@ -67,8 +123,8 @@ static void window_reset_layer_edges(GtkWindow *window) {
 }
 
 // Applies anchor driven placement used when x and y percent are not configured
-static void window_apply_anchor_placement(const WindowState *state) {
-    GtkWindow *window = GTK_WINDOW(state->window);
+static void window_apply_anchor_placement(const WindowState *state, WindowView *view) {
+    GtkWindow *window = GTK_WINDOW(view->window);
 
     // Switch keeps per anchor edge and margin mapping explicit
     switch (state->args.theme.anchor) {
@@ -111,58 +167,83 @@ static void window_apply_anchor_placement(const WindowState *state) {
     }
 }
 
+// Percent placement needs both coordinates and a monitor to measure against
+static bool window_uses_percent_placement(const WindowState *state, const WindowView *view) {
+    return state->args.theme.x_percent >= 0 && state->args.theme.y_percent >= 0 && view->monitor != NULL;
+}
+
 // Applies explicit percent placement relative to monitor geometry
-static void window_apply_percent_placement(WindowState *state, GdkMonitor *monitor) {
+static void window_apply_percent_placement(WindowState *state, WindowView *view) {
+    GtkWindow *window = GTK_WINDOW(view->window);
     GdkRectangle geometry;
     int margin_left = 0;
     int margin_top = 0;
 
-    gdk_monitor_get_geometry(monitor, &geometry);
+    gdk_monitor_get_geometry(view->monitor, &geometry);
     // Percent coordinates are interpreted relative to monitor work area
     margin_left = window_percent_to_margin(state->args.theme.x_percent, geometry.width, state->args.theme.width_px);
     margin_top = window_percent_to_margin(state->args.theme.y_percent, geometry.height, state->args.theme.height_px);
 
-    gtk_layer_set_anchor(GTK_WINDOW(state->window), GTK_LAYER_SHELL_EDGE_TOP, TRUE);
-    gtk_layer_set_anchor(GTK_WINDOW(state->window), GTK_LAYER_SHELL_EDGE_LEFT, TRUE);
-    gtk_layer_set_margin(GTK_WINDOW(state->window), GTK_LAYER_SHELL_EDGE_LEFT, margin_left);
-    gtk_layer_set_margin(GTK_WINDOW(state->window), GTK_LAYER_SHELL_EDGE_TOP, margin_top);
+    gtk_layer_set_anchor(window, GTK_LAYER_SHELL_EDGE_TOP, TRUE);
+    gtk_layer_set_anchor(window, GTK_LAYER_SHELL_EDGE_LEFT, TRUE);
+    gtk_layer_set_margin(window, GTK_LAYER_SHELL_EDGE_LEFT, margin_left);
+    gtk_layer_set_margin(window, GTK_LAYER_SHELL_EDGE_TOP, margin_top);
+    view->placement_cache.geometry = geometry;
+    view->placement_cache.valid = true;
 }
 
-// Configures the window as a layer shell overlay and selects placement mode
-void window_apply_placement(WindowState *state) {
-    GdkMonitor *target_monitor = NULL;
+bool window_refresh_placement(WindowState *state, WindowView *view) {
+    GdkRectangle geometry;
+
+    if (!gtk_layer_is_supported() || !gtk_layer_is_layer_window(GTK_WINDOW(view->window)) ||
+        !window_uses_percent_placement(state, view)) {
+        // Anchor placement follows the monitor on the compositor side, so geometry never matters
+        return false;
+    }
+
+    gdk_monitor_get_geometry(view->monitor, &geometry);
+    if (view->placement_cache.valid && gdk_rectangle_equal(&geometry, &view->placement_cache.geometry)) {
+        return false;
+    }
+
+    // Anchors are already top left, so only the two margins move
+    window_apply_percent_placement(state, view);
+    return true;
+}
+
+// Configures one view as a layer shell overlay and selects placement mode
+void window_apply_placement(WindowState *state, WindowView *view) {
+    GtkWindow *window = GTK_WINDOW(view->window);
 
     if (!gtk_layer_is_supported()) {
         g_warning("layer-shell protocol unavailable; falling back to regular GTK popup window");
         return;
     }
 
-    gtk_layer_init_for_window(GTK_WINDOW(state->window));
+    if (!gtk_layer_is_layer_window(window)) {
+        // Config reload reapplies placement on an already initialized surface
+        gtk_layer_init_for_window(window);
+    }
     // Namespace enables compositor side targeted rules for this overlay
-    gtk_layer_set_namespace(GTK_WINDOW(state->window), "hyprvolume");
-    gtk_layer_set_layer(GTK_WINDOW(state->window), GTK_LAYER_SHELL_LAYER_OVERLAY);
-    window_reset_layer_edges(GTK_WINDOW(state->window));
+    gtk_layer_set_namespace(window, "hyprvolume");
+    gtk_layer_set_layer(window, GTK_LAYER_SHELL_LAYER_OVERLAY);
+    window_reset_layer_edges(window);
+    view->placement_cache.valid = false;
 
-    target_monitor = window_get_target_monitor(state->args.monitor_index);
-    if (target_monitor != NULL) {
+    if (view->monitor != NULL) {
         // Monitor pinning applies only when a valid monitor object exists
-        gtk_layer_set_monitor(GTK_WINDOW(state->window), target_monitor);
+        gtk_layer_set_monitor(window, view->monitor);
     }
 
-    if (state->args.theme.x_percent >= 0 && state->args.theme.y_percent >= 0 && target_monitor != NULL) {
+    if (window_uses_percent_placement(state, view)) {
         // Percent placement has priority when both coordinates are configured
-        window_apply_percent_placement(state, target_monitor);
+        window_apply_percent_placement(state, view);
     } else {
         // Anchor placement is fallback for unset percent coordinates
-        window_apply_anchor_placement(state);
-    }
-
-    if (target_monitor != NULL) {
-        // Drop monitor reference returned by window_get_target_monitor
-        g_object_unref(target_monitor);
+        window_apply_anchor_placement(state, view);
     }
 
     // Overlay should never reserve layout space in compositor stacking
-    gtk_layer_set_exclusive_zone(GTK_WINDOW(state->window), -1);
-    gtk_layer_set_keyboard_mode(GTK_WINDOW(state->window), GTK_LAYER_SHELL_KEYBOARD_MODE_NONE);
+    gtk_layer_set_exclusive_zone(window, -1);
+    gtk_layer_set_keyboard_mode(window, GTK_LAYER_SHELL_KEYBOARD_MODE_NONE);
 }
@@ -1,9 +1,94 @@
 #include "internal.h"
 
 #include "style/style.h"
+#include "window/card.h"
+#include "window/percent_label.h"
+#include "window/volume_bar.h"
+
+void window_icons_clear(WindowState *state) {
+    for (size_t index = 0U; index < G_N_ELEMENTS(state->icon_paintables); index++) {
+        g_clear_object(&state->icon_paintables[index]);
+    }
+}
+
+// Rasterizes a paintable once so its first on-screen use only blits a cached texture
+static void window_icons_warm(GdkPaintable *paintable, double size_px) {
+    GtkSnapshot *snapshot = gtk_snapshot_new();
+    GskRenderNode *node = NULL;
+
+    gdk_paintable_snapshot(paintable, GDK_SNAPSHOT(snapshot), size_px, size_px);
+    node = gtk_snapshot_free_to_node(snapshot);
+    if (node != NULL) {
+        gsk_render_node_unref(node);
+    }
+}
+
+void window_icons_prepare(WindowState *state) {
+    const int size_px = (int)state->args.theme.icon_size_px;
+    int scale = 1;
+
+    window_icons_clear(state);
+    if (state->args.theme.system_icons) {
+        return;
+    }
+
+    // One set serves every view, so it is rasterized for the densest monitor and downscaled elsewhere
+    for (unsigned int index = 0U; index < state->view_count; index++) {
+        scale = MAX(scale, gtk_widget_get_scale_factor(state->views[index]->window));
+    }
+
+    for (size_t index = 0U; index < G_N_ELEMENTS(state->icon_paintables); index++) {
+        const char *uri = osd_style_icon_resource_uri_for_bucket((OSDIconBucket)index);
+        GFile *file = g_file_new_for_uri(uri);
+
+        // Symbolic file names keep CSS recoloring through GtkSymbolicPaintable
+        state->icon_paintables[index] = GDK_PAINTABLE(gtk_icon_paintable_new_for_file(file, size_px, scale));
+        g_object_unref(file);
+        if (state->args.watch_mode) {
+            // Long running watchers pay rasterization up front, one shot popups load only what they show
+            window_icons_warm(state->icon_paintables[index], (double)size_px);
+        }
+    }
+}
+
+// Picks the snapshot drawn bar when the built-in theme alone styles the popup
+// Custom sheets may target trough and progress nodes, so they keep GtkProgressBar
+static GtkWidget *window_build_volume_bar(WindowState *state, GtkOrientation orientation) {
+    const OSDArgs *args = &state->args;
+    OSDStylePaint track_paint;
+    OSDStylePaint fill_paint;
+    GtkWidget *progress_bar = NULL;
+
+    if (!args->css_replace && !args->css_path_set && osd_style_parse_paint(args->theme.track_color, &track_paint) &&
+        osd_style_parse_paint(args->theme.fill_color, &fill_paint)) {
+        return window_volume_bar_new(orientation, &track_paint, &fill_paint);
+    }
+
+    // Values only CSS understands, such as radial gradients, stay on the CSS path
+    progress_bar = gtk_progress_bar_new();
+    gtk_progress_bar_set_show_text(GTK_PROGRESS_BAR(progress_bar), FALSE);
+    gtk_orientable_set_orientation(GTK_ORIENTABLE(progress_bar), orientation);
+    return progress_bar;
+}
+
+// Picks the card with prerendered decoration under the same conditions as the snapshot bar
+// Custom sheets may restyle the card, so they keep the CSS drawn GtkBox
+static GtkWidget *window_build_card(WindowState *state, GtkOrientation orientation) {
+    const OSDArgs *args = &state->args;
+    OSDStylePaint background_paint;
+    OSDStylePaint border_paint;
+
+    if (!args->css_replace && !args->css_path_set &&
+        osd_style_parse_paint(args->theme.background_color, &background_paint) &&
+        osd_style_parse_paint(args->theme.border_color, &border_paint) && border_paint.stop_count == 1U) {
+        return window_card_new(orientation, &background_paint, &border_paint, args->theme.corner_radius_px);
+    }
+
+    return gtk_box_new(orientation, 0);
+}
 
 // Builds the fixed widget hierarchy used for all runtime themes
-void window_build_widgets(WindowState *state) {
+void window_build_widgets(WindowState *state, WindowView *view) {
     GtkWidget *container = NULL;
     GtkOrientation orientation = GTK_ORIENTATION_HORIZONTAL;
     bool is_vertical = false;
@@ -15,105 +100,296 @@ void window_build_widgets(WindowState *state) {
     }
 
     // Layout remains stable across themes with icon progress bar and label
-    container = gtk_box_new(orientation, 0);
+    container = window_build_card(state, orientation);
     // Card class owns border and background styling in CSS theme
     gtk_widget_add_css_class(container, "osd-card");
     if (is_vertical) {
         // Vertical modifier enables direction specific spacing rules
         gtk_widget_add_css_class(container, "vertical");
     }
-    gtk_window_set_child(GTK_WINDOW(state->window), container);
+    gtk_window_set_child(GTK_WINDOW(view->window), container);
+    // A rebuild while keep-mapped holds a hidden surface must stay transparent
+    gtk_widget_set_opacity(container, state->popup_visible ? 1.0 : 0.0);
+    // Fresh widgets hold placeholder content so the next render must write everything
+    // Replacing the child destroyed the old bar along with any tick callback it carried
+    view->render_cache.valid = false;
+    view->bar_animation.tick_id = 0U;
+    state->render_pending = true;
 
-    state->icon_overlay = gtk_overlay_new();
+    view->icon_overlay = gtk_overlay_new();
     // Overlay allows slash indicator to be layered over volume icon
-    gtk_widget_set_valign(state->icon_overlay, GTK_ALIGN_CENTER);
-    gtk_widget_set_halign(state->icon_overlay, GTK_ALIGN_CENTER);
-    gtk_widget_add_css_class(state->icon_overlay, "osd-icon-wrap");
+    gtk_widget_set_valign(view->icon_overlay, GTK_ALIGN_CENTER);
+    gtk_widget_set_halign(view->icon_overlay, GTK_ALIGN_CENTER);
+    gtk_widget_add_css_class(view->icon_overlay, "osd-icon-wrap");
     if (is_vertical) {
-        gtk_widget_add_css_class(state->icon_overlay, "vertical");
+        gtk_widget_add_css_class(view->icon_overlay, "vertical");
     }
 
-    state->icon_image = gtk_image_new_from_icon_name("audio-volume-medium-symbolic");
+    // Image starts empty so no icon theme lookup happens before the first render
+    view->icon_image = gtk_image_new();
     // Pixel size comes from theme config for predictable scaling
-    gtk_image_set_pixel_size(GTK_IMAGE(state->icon_image), (int)state->args.theme.icon_size_px);
-    gtk_widget_set_valign(state->icon_image, GTK_ALIGN_CENTER);
-    gtk_widget_set_halign(state->icon_image, GTK_ALIGN_CENTER);
-    gtk_widget_add_css_class(state->icon_image, "osd-icon");
-    gtk_overlay_set_child(GTK_OVERLAY(state->icon_overlay), state->icon_image);
+    gtk_image_set_pixel_size(GTK_IMAGE(view->icon_image), (int)state->args.theme.icon_size_px);
+    gtk_widget_set_valign(view->icon_image, GTK_ALIGN_CENTER);
+    gtk_widget_set_halign(view->icon_image, GTK_ALIGN_CENTER);
+    gtk_widget_add_css_class(view->icon_image, "osd-icon");
+    gtk_overlay_set_child(GTK_OVERLAY(view->icon_overlay), view->icon_image);
 
-    state->muted_slash = gtk_label_new("/");
+    view->muted_slash = gtk_label_new("/");
     // Slash overlay is toggled by runtime mute state updates
-    gtk_widget_set_halign(state->muted_slash, GTK_ALIGN_CENTER);
-    gtk_widget_set_valign(state->muted_slash, GTK_ALIGN_CENTER);
-    gtk_widget_set_visible(state->muted_slash, FALSE);
-    gtk_widget_add_css_class(state->muted_slash, "osd-icon-slash");
-    gtk_overlay_add_overlay(GTK_OVERLAY(state->icon_overlay), state->muted_slash);
-
-    gtk_box_append(GTK_BOX(container), state->icon_overlay);
-
-    state->progress_bar = gtk_progress_bar_new();
-    // Progress bar orientation tracks overall layout orientation
-    gtk_widget_set_valign(state->progress_bar, GTK_ALIGN_CENTER);
-    gtk_widget_set_halign(state->progress_bar, GTK_ALIGN_CENTER);
-    gtk_progress_bar_set_show_text(GTK_PROGRESS_BAR(state->progress_bar), FALSE);
-    gtk_orientable_set_orientation(GTK_ORIENTABLE(state->progress_bar), orientation);
-    gtk_widget_set_hexpand(state->progress_bar, !is_vertical);
-    gtk_widget_set_vexpand(state->progress_bar, is_vertical);
-    gtk_widget_add_css_class(state->progress_bar, "osd-bar");
+    gtk_widget_set_halign(view->muted_slash, GTK_ALIGN_CENTER);
+    gtk_widget_set_valign(view->muted_slash, GTK_ALIGN_CENTER);
+    gtk_widget_set_visible(view->muted_slash, FALSE);
+    gtk_widget_add_css_class(view->muted_slash, "osd-icon-slash");
+    gtk_overlay_add_overlay(GTK_OVERLAY(view->icon_overlay), view->muted_slash);
+
+    gtk_box_append(GTK_BOX(container), view->icon_overlay);
+    if (WINDOW_IS_CARD(container)) {
+        // Tile background is baked into the card texture next to the card itself
+        window_card_set_icon_wrap(WINDOW_CARD(container), view->icon_overlay);
+    }
+
+    view->progress_bar = window_build_volume_bar(state, orientation);
+    // Bar orientation tracks overall layout orientation
+    gtk_widget_set_valign(view->progress_bar, GTK_ALIGN_CENTER);
+    gtk_widget_set_halign(view->progress_bar, GTK_ALIGN_CENTER);
+    gtk_widget_set_hexpand(view->progress_bar, !is_vertical);
+    gtk_widget_set_vexpand(view->progress_bar, is_vertical);
+    gtk_widget_add_css_class(view->progress_bar, "osd-bar");
     if (is_vertical) {
         // Vertical modifier class switches trough and progress sizing CSS
-        gtk_widget_add_css_class(state->progress_bar, "vertical");
+        gtk_widget_add_css_class(view->progress_bar, "vertical");
     }
-    gtk_box_append(GTK_BOX(container), state->progress_bar);
+    gtk_box_append(GTK_BOX(container), view->progress_bar);
 
-    state->percent_label = gtk_label_new("0%");
+    view->percent_label = window_percent_label_new();
     // Label text is updated per volume sample in window_update_widgets
-    gtk_widget_set_valign(state->percent_label, GTK_ALIGN_CENTER);
-    gtk_widget_set_halign(state->percent_label, GTK_ALIGN_CENTER);
-    gtk_label_set_xalign(GTK_LABEL(state->percent_label), 0.5F);
-    gtk_widget_add_css_class(state->percent_label, "osd-percent");
+    gtk_widget_set_valign(view->percent_label, GTK_ALIGN_CENTER);
+    gtk_widget_set_halign(view->percent_label, GTK_ALIGN_CENTER);
+    gtk_widget_add_css_class(view->percent_label, "osd-percent");
     if (is_vertical) {
-        gtk_widget_add_css_class(state->percent_label, "vertical");
+        gtk_widget_add_css_class(view->percent_label, "vertical");
+    }
+    gtk_box_append(GTK_BOX(container), view->percent_label);
+}
+
+// Builds base, theme variable, and optional custom providers from args without installing them
+// A non-NULL *out_base_provider on entry is reused since the base sheet never depends on args
+// load_custom false skips css_path, leaving *out_custom_provider NULL
+static bool window_build_css_providers(
+    const OSDArgs *args,
+    bool load_custom,
+    GtkCssProvider **out_base_provider,
+    GtkCssProvider **out_theme_provider,
+    GtkCssProvider **out_custom_provider
+) {
+    GtkCssProvider *base_provider = NULL;
+    GtkCssProvider *theme_provider = NULL;
+    GtkCssProvider *custom_provider = NULL;
+
+    if (!args->css_replace) {
+        // Built in provider establishes baseline card and slider styling
+        base_provider = (*out_base_provider != NULL) ? g_object_ref(*out_base_provider)
+                                                     : osd_style_build_base_provider();
+        if (base_provider == NULL) {
+            return false;
+        }
     }
-    gtk_box_append(GTK_BOX(container), state->percent_label);
+
+    // Variables are defined even with css_replace so custom sheets can read theme values
+    theme_provider = osd_style_build_provider(&args->theme);
+    if (theme_provider == NULL) {
+        g_clear_object(&base_provider);
+        return false;
+    }
+
+    if (load_custom && args->css_path_set) {
+        // Optional custom provider is loaded after base provider
+        if (!osd_style_build_custom_provider(args->css_path, &custom_provider, stderr)) {
+            g_clear_object(&base_provider);
+            g_clear_object(&theme_provider);
+            return false;
+        }
+    }
+
+    *out_base_provider = base_provider;
+    *out_theme_provider = theme_provider;
+    *out_custom_provider = custom_provider;
+    return true;
 }
 
-// Creates and installs a display scoped CSS provider for the active window
+// Adds or removes one provider on the display
+static void window_set_css_provider_installed(
+    GdkDisplay *display,
+    GtkCssProvider *provider,
+    guint priority,
+    bool installed
+) {
+    if (provider == NULL) {
+        return;
+    }
+
+    if (installed) {
+        gtk_style_context_add_provider_for_display(display, GTK_STYLE_PROVIDER(provider), priority);
+    } else {
+        gtk_style_context_remove_provider_for_display(display, GTK_STYLE_PROVIDER(provider));
+    }
+}
+
+// Adds or removes a provider set on the display in priority order
+static void window_set_css_providers_installed(
+    GdkDisplay *display,
+    GtkCssProvider *base_provider,
+    GtkCssProvider *theme_provider,
+    GtkCssProvider *custom_provider,
+    bool installed
+) {
+    // Base rules and variable definitions never set the same property so they share a priority
+    window_set_css_provider_installed(display, base_provider, GTK_STYLE_PROVIDER_PRIORITY_APPLICATION, installed);
+    window_set_css_provider_installed(display, theme_provider, GTK_STYLE_PROVIDER_PRIORITY_APPLICATION, installed);
+    // Custom provider sits one step above base so user rules and variable overrides win
+    window_set_css_provider_installed(
+        display,
+        custom_provider,
+        GTK_STYLE_PROVIDER_PRIORITY_APPLICATION + 1U,
+        installed
+    );
+}
+
+// Creates and installs display scoped CSS providers for the active window
 bool window_init_css(WindowState *state) {
     GdkDisplay *display = NULL;
+    // Last good custom sheet kept uninstalled across a release, NULL at startup
+    GtkCssProvider *kept_custom_provider = state->custom_css_provider;
+    bool custom_loaded = true;
 
-    display = gtk_widget_get_display(state->window);
+    // Providers live on the display rather than a window, so every view shares one set
+    display = gdk_display_get_default();
     if (display == NULL) {
         // Display must exist before adding display scoped providers
         return false;
     }
 
-    if (!state->args.css_replace) {
-        // Built in provider establishes baseline card and slider styling
-        state->css_provider = osd_style_build_provider(&state->args.theme);
-        if (state->css_provider == NULL) {
+    state->custom_css_provider = NULL;
+    if (!window_build_css_providers(
+            &state->args,
+            true,
+            &state->css_provider,
+            &state->theme_css_provider,
+            &state->custom_css_provider
+        )) {
+        // A custom file broken while released must not take the built-in card down with it
+        custom_loaded = false;
+        if (!window_build_css_providers(
+                &state->args,
+                false,
+                &state->css_provider,
+                &state->theme_css_provider,
+                &state->custom_css_provider
+            )) {
+            state->custom_css_provider = kept_custom_provider;
             return false;
         }
+        state->custom_css_provider = kept_custom_provider;
+        kept_custom_provider = NULL;
+        if (state->custom_css_provider != NULL) {
+            g_printerr("Custom CSS failed to load; keeping the last good custom style\n");
+        }
+    }
+    g_clear_object(&kept_custom_provider);
+
+    window_set_css_providers_installed(
+        display,
+        state->css_provider,
+        state->theme_css_provider,
+        state->custom_css_provider,
+        true
+    );
+    return custom_loaded || state->custom_css_provider != NULL;
+}
+
+// Rebuilds providers from current args and swaps them in only when all built
+bool window_reload_css(WindowState *state) {
+    GdkDisplay *display = NULL;
+    GtkCssProvider *base_provider = state->css_provider;
+    GtkCssProvider *theme_provider = NULL;
+    GtkCssProvider *custom_provider = NULL;
 
-        gtk_style_context_add_provider_for_display(
-            display,
-            GTK_STYLE_PROVIDER(state->css_provider),
-            GTK_STYLE_PROVIDER_PRIORITY_APPLICATION
-        );
+    display = gdk_display_get_default();
+    if (display == NULL) {
+        return false;
     }
 
-    if (state->args.css_path_set) {
-        // Optional custom provider is loaded after base provider
-        if (!osd_style_build_custom_provider(state->args.css_path, &state->custom_css_provider, stderr)) {
-            return false;
-        }
+    if (!window_build_css_providers(&state->args, true, &base_provider, &theme_provider, &custom_provider)) {
+        // Broken theme or custom CSS keeps the previous look on screen
+        return false;
+    }
+
+    // Swap completes within one main loop turn so no frame renders unstyled
+    window_set_css_providers_installed(display, NULL, theme_provider, custom_provider, true);
+    window_set_css_providers_installed(display, NULL, state->theme_css_provider, state->custom_css_provider, false);
+    if (base_provider != state->css_provider) {
+        // Base sheet only changes when css_replace toggles
+        window_set_css_providers_installed(display, base_provider, NULL, NULL, true);
+        window_set_css_providers_installed(display, state->css_provider, NULL, NULL, false);
+    }
+    g_clear_object(&state->css_provider);
+    g_clear_object(&state->theme_css_provider);
+    g_clear_object(&state->custom_css_provider);
+    state->css_provider = base_provider;
+    state->theme_css_provider = theme_provider;
+    state->custom_css_provider = custom_provider;
+    return true;
+}
+
+// Swaps only the variables provider so a theme change re-parses a few hundred bytes
+bool window_reload_theme_css(WindowState *state) {
+    GdkDisplay *display = NULL;
+    GtkCssProvider *theme_provider = NULL;
+
+    if (state == NULL || state->view_count == 0U) {
+        return false;
+    }
+
+    display = gdk_display_get_default();
+    if (display == NULL) {
+        return false;
+    }
+
+    theme_provider = osd_style_build_provider(&state->args.theme);
+    if (theme_provider == NULL) {
+        return false;
+    }
+
+    window_set_css_providers_installed(display, NULL, theme_provider, NULL, true);
+    window_set_css_providers_installed(display, NULL, state->theme_css_provider, NULL, false);
+    g_clear_object(&state->theme_css_provider);
+    state->theme_css_provider = theme_provider;
+    return true;
+}
+
+// Rebuilds the custom provider alone so base theme CSS is never regenerated for file edits
+bool window_reload_custom_css(WindowState *state) {
+    GdkDisplay *display = NULL;
+    GtkCssProvider *custom_provider = NULL;
+
+    if (state == NULL || state->view_count == 0U || !state->args.css_path_set) {
+        return false;
+    }
+
+    display = gdk_display_get_default();
+    if (display == NULL) {
+        return false;
+    }
 
-        gtk_style_context_add_provider_for_display(
-            display,
-            GTK_STYLE_PROVIDER(state->custom_css_provider),
-            GTK_STYLE_PROVIDER_PRIORITY_APPLICATION + 1U
-        );
+    // Same loader as startup so UTF-8, size, and parsing checks stay identical
+    if (!osd_style_build_custom_provider(state->args.css_path, &custom_provider, stderr)) {
+        return false;
     }
 
+    // New provider goes in before the old one leaves so no frame renders without user rules
+    window_set_css_providers_installed(display, NULL, NULL, custom_provider, true);
+    window_set_css_providers_installed(display, NULL, NULL, state->custom_css_provider, false);
+    g_clear_object(&state->custom_css_provider);
+    state->custom_css_provider = custom_provider;
     return true;
 }
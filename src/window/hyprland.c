@@ -0,0 +1,174 @@
+#include "internal.h"
+
+#include <glib-unix.h>
+#include <string.h>
+#include <unistd.h>
+
+// Drains the event socket on the GTK main loop
+// Focus changes are only recorded here and applied at the next show, so a hidden popup pays a read and a copy
+// Fullscreen changes unmap or restore the affected views right away so a game regains direct scanout
+static gboolean window_hyprland_on_events(gint fd, GIOCondition condition, gpointer user_data) {
+    WindowState *state = user_data;
+    OSDHyprlandReadStatus status = OSD_HYPRLAND_READ_OK;
+    unsigned int changes = OSD_HYPRLAND_CHANGE_NONE;
+
+    (void)condition;
+    status = osd_hyprland_read_events(fd, &state->hyprland_events, &state->hyprland, &changes);
+    if ((changes & OSD_HYPRLAND_CHANGE_FOCUS) != 0U) {
+        state->focus_pending = true;
+        state->stats.focus_events++;
+    }
+    if ((changes & (OSD_HYPRLAND_CHANGE_FOCUS | OSD_HYPRLAND_CHANGE_FULLSCREEN)) != 0U &&
+        window_fullscreen_update_views(state)) {
+        window_runtime_sync_views(state);
+    }
+    if (status == OSD_HYPRLAND_READ_OK) {
+        return G_SOURCE_CONTINUE;
+    }
+
+    // Restarted compositors get a new signature, so reconnecting here could never succeed
+    g_printerr("Hyprland event socket closed; keeping the last known focus and fullscreen state\n");
+    (void)close(state->hyprland_fd);
+    state->hyprland_fd = -1;
+    state->hyprland_source_id = 0U;
+    return G_SOURCE_REMOVE;
+}
+
+void window_hyprland_cleanup(WindowState *state) {
+    if (state->hyprland_source_id == 0U) {
+        return;
+    }
+
+    g_source_remove(state->hyprland_source_id);
+    state->hyprland_source_id = 0U;
+    (void)close(state->hyprland_fd);
+    state->hyprland_fd = -1;
+}
+
+void window_hyprland_sync(WindowState *state) {
+    const bool wanted = state->args.watch_mode && (state->args.monitors.focused || state->args.suppress_fullscreen);
+
+    if (!wanted) {
+        window_hyprland_cleanup(state);
+        return;
+    }
+    if (state->hyprland_source_id != 0U) {
+        return;
+    }
+
+    // One shot popups never see an event, and the compositor already places them on the focused output
+    state->hyprland_fd = osd_hyprland_open_event_socket();
+    if (state->hyprland_fd < 0) {
+        g_printerr("Hyprland event socket unavailable; monitor focus and fullscreen clients are not followed\n");
+        return;
+    }
+    // Whatever happened while disconnected is unknown, so state starts over as nothing fullscreen
+    memset(&state->hyprland_events, 0, sizeof(state->hyprland_events));
+    memset(&state->hyprland, 0, sizeof(state->hyprland));
+    // Without the seed, a session that never switches workspaces would never say which one fullscreen events mean
+    if (!osd_hyprland_seed_state(&state->hyprland)) {
+        g_printerr("Hyprland monitor query failed; focus and fullscreen state start unknown until the next event\n");
+    }
+    state->hyprland_source_id =
+        g_unix_fd_add(state->hyprland_fd, G_IO_IN | G_IO_HUP | G_IO_ERR, window_hyprland_on_events, state);
+}
+
+GdkMonitor *window_focus_lookup_monitor(const WindowState *state) {
+    GdkDisplay *display = gdk_display_get_default();
+    GListModel *monitors = NULL;
+    guint monitor_count = 0U;
+
+    if (state->hyprland.focused_monitor[0] == '\0' || display == NULL) {
+        return NULL;
+    }
+
+    // Hyprland names outputs by connector, which GDK reports for every Wayland monitor
+    monitors = gdk_display_get_monitors(display);
+    monitor_count = g_list_model_get_n_items(monitors);
+    for (guint index = 0U; index < monitor_count; index++) {
+        GdkMonitor *monitor = GDK_MONITOR(g_list_model_get_item(monitors, index));
+        const char *connector = gdk_monitor_get_connector(monitor);
+
+        if (connector != NULL && strcmp(connector, state->hyprland.focused_monitor) == 0) {
+            return monitor;
+        }
+        g_object_unref(monitor);
+    }
+    return NULL;
+}
+
+void window_focus_apply(WindowState *state) {
+    WindowView *view = NULL;
+    GdkMonitor *monitor = NULL;
+
+    if (!state->args.monitors.focused || !state->focus_pending || state->view_count == 0U) {
+        return;
+    }
+    state->focus_pending = false;
+
+    view = state->views[0];
+    monitor = window_focus_lookup_monitor(state);
+    if (monitor == NULL || monitor == view->monitor) {
+        // Unknown connectors keep the current pin until GDK learns about the output
+        g_clear_object(&monitor);
+        return;
+    }
+
+    window_monitors_set_view_monitor(state, view, monitor);
+    window_apply_placement(state, view);
+    state->stats.placement_updates++;
+}
+
+// Focus following targets the focused output whatever the view is pinned to, unpinned views land there too
+static bool window_fullscreen_on_monitor(const WindowState *state, GdkMonitor *monitor) {
+    const char *connector = NULL;
+
+    if (!state->args.suppress_fullscreen || state->hyprland_source_id == 0U) {
+        return false;
+    }
+    if (!state->args.monitors.focused && monitor != NULL) {
+        connector = gdk_monitor_get_connector(monitor);
+    }
+    return osd_hyprland_monitor_is_fullscreen(&state->hyprland, connector);
+}
+
+bool window_fullscreen_update_views(WindowState *state) {
+    bool changed = false;
+
+    for (unsigned int index = 0U; index < state->view_count; index++) {
+        WindowView *view = state->views[index];
+        const bool suppressed = window_fullscreen_on_monitor(state, view->monitor);
+
+        if (view->suppressed != suppressed) {
+            view->suppressed = suppressed;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+bool window_fullscreen_blocks_show(WindowState *state) {
+    GdkMonitor *monitors[WINDOW_MAX_VIEWS] = {NULL};
+    unsigned int count = 0U;
+    bool blocked = true;
+
+    if (!state->args.suppress_fullscreen || state->hyprland_source_id == 0U) {
+        return false;
+    }
+
+    if (state->view_count > 0U) {
+        (void)window_fullscreen_update_views(state);
+        for (unsigned int index = 0U; index < state->view_count; index++) {
+            blocked = blocked && state->views[index]->suppressed;
+        }
+        return blocked;
+    }
+
+    // Released popups are judged by the monitors they would be rebuilt on, so a blocked show never rebuilds them
+    count = window_resolve_monitors(state, monitors);
+    for (unsigned int index = 0U; index < count; index++) {
+        blocked = blocked && window_fullscreen_on_monitor(state, monitors[index]);
+        g_clear_object(&monitors[index]);
+    }
+    return blocked;
+}
@@ -2,15 +2,168 @@
 #define WINDOW_INTERNAL_H
 
 #include "args/args.h"
+#include "style/style.h"
+#include "system/hyprland.h"
+#include "system/resource.h"
+#include "window/window.h"
 
 #include <gtk/gtk.h>
+#include <stdio.h>
 
-// Shared runtime state for the GTK window flow
+// Runtime seams keep timers, clock, and volume source replaceable for simulations
+typedef gint64 (*WindowClockFn)(void);
+typedef bool (*WindowVolumeQueryFn)(OSDVolumeState *out_state, FILE *err_stream);
+typedef guint (*WindowTimeoutAddFn)(guint interval_ms, GSourceFunc callback, gpointer user_data);
+typedef gboolean (*WindowSourceRemoveFn)(guint source_id);
+
+// Main loop work the stall watchdog attributes blocking time to
+typedef enum {
+    WINDOW_PHASE_IDLE = 0,
+    // Synchronous wpctl spawn and read
+    WINDOW_PHASE_WPCTL,
+    // Config file reload and the changes it applies
+    WINDOW_PHASE_CONFIG,
+    // Custom CSS rebuild
+    WINDOW_PHASE_CSS,
+    // Widget updates from a volume sample
+    WINDOW_PHASE_RENDER,
+    // Blocking seen only as a late watch poll, outside any tagged phase
+    WINDOW_PHASE_OTHER,
+    WINDOW_PHASE_COUNT
+} WindowPhase;
+
+// Long-running watch counters surfaced through runtime diagnostics
+typedef struct {
+    // Clock value captured when the runtime was activated
+    gint64 started_us;
+    // Due time of the pending watch poll used for drift tracking
+    gint64 watch_poll_due_us;
+    // Largest observed lateness of a watch poll against its due time
+    gint64 max_poll_drift_us;
+    // Watch poll callbacks that ran
+    guint64 watch_polls;
+    // Watch poll timers armed
+    guint64 watch_timer_arms;
+    // Auto hide timers armed
+    guint64 hide_timer_arms;
+    // Hidden to visible transitions
+    guint64 popup_shows;
+    // Visible to hidden transitions
+    guint64 popup_hides;
+    // Frame ticks that applied queued samples, and samples replaced by a newer one before their frame
+    guint64 sample_frames;
+    guint64 samples_coalesced;
+    // Failed volume queries in watch mode
+    guint64 query_failures;
+    // Failure streaks that cleared
+    guint64 query_recoveries;
+    // Frames that ran a paint phase, with wall time from before-paint to after-paint
+    guint64 frames_painted;
+    gint64 frame_paint_total_us;
+    gint64 frame_paint_max_us;
+    // Start of the frame currently in flight and whether it reached the paint phase
+    gint64 frame_started_us;
+    bool frame_painting;
+    // Shows whose first frame was painted, with wall time from the show request to that frame
+    guint64 shows_painted;
+    gint64 show_latency_total_us;
+    gint64 show_latency_max_us;
+    // Pending show request time, zero once its first frame was painted
+    gint64 show_started_us;
+    // Release hide mode teardowns with RSS sampled around the latest one
+    guint64 window_releases;
+    long long release_rss_before_kib;
+    long long release_rss_after_kib;
+    // Release hide mode rebuilds with wall time of window, widgets, and CSS construction
+    guint64 window_restores;
+    gint64 restore_total_us;
+    gint64 restore_max_us;
+    // Monitor list changes seen, and placements actually reapplied after hotplug or geometry changes
+    guint64 monitor_changes;
+    guint64 placement_updates;
+    // Focus changes read from the Hyprland event socket
+    guint64 focus_events;
+    // Shows skipped because every target monitor had a fullscreen client
+    guint64 fullscreen_suppressions;
+    // Bar animation ticks, samples merged into a running animation, and refresh cycles skipped between ticks
+    guint64 animation_frames;
+    guint64 animation_retargets;
+    guint64 animation_missed_frames;
+    // Animation frames whose before-paint to after-paint time exceeded the refresh interval
+    guint64 animation_over_budget;
+    // Refresh interval of the latest animation frame, the budget each frame is measured against
+    gint64 animation_budget_us;
+    // Frame currently in flight ran an animation tick
+    bool frame_animating;
+    // Layout phases the frame clocks ran, each a restyle or size allocation pass over a window
+    guint64 layout_passes;
+    // Painted frames whose window size differed from the previous painted frame of the same view
+    guint64 window_resizes;
+    // Main loop stalls past the watchdog threshold per phase, idle unused, and the longest one
+    guint64 stalls[WINDOW_PHASE_COUNT];
+    gint64 stall_max_us;
+    // Process resources sampled at activation for growth reporting
+    OSDResourceUsage baseline_resources;
+} WindowRuntimeStats;
+
+// Last values pushed into widgets so unchanged outputs never invalidate style or layout
+typedef struct {
+    // False until the first render after widgets are built
+    bool valid;
+    // Icon bucket last set on the image
+    OSDIconBucket icon_bucket;
+    // Fraction last set on the progress bar
+    double fraction;
+    // Mute state last applied to classes and slash
+    bool muted;
+} WindowRenderCache;
+
+// Monitor geometry the percent placement margins of one view were computed from
+typedef struct {
+    // False while anchor placement is active or before the first percent placement
+    bool valid;
+    GdkRectangle geometry;
+} WindowPlacementCache;
+
+// Watchdog thread state, every field below lock is shared with the thread
+typedef struct {
+    GThread *thread;
+    GMutex lock;
+    // Wakes the thread when a phase starts or the watchdog stops
+    GCond cond;
+    bool stopping;
+    WindowPhase phase;
+    // Real monotonic time the running phase began
+    gint64 phase_started_us;
+    // Bumped per phase so the thread reports each stall once
+    guint64 phase_serial;
+    guint64 reported_serial;
+    // Main loop only: nesting depth of tagged phases, and when the latest tagged stall ended
+    unsigned int depth;
+    gint64 last_stall_end_us;
+} WindowWatchdog;
+
+// Bar fraction eased toward the latest sample on one view's frame clock
+typedef struct {
+    // Fraction currently drawn
+    double shown;
+    // Segment being animated
+    double start;
+    double target;
+    // Frame time the segment began, zero until its first tick
+    gint64 started_us;
+    // Frame time of the previous tick, for missed refresh accounting
+    gint64 last_frame_us;
+    // Tick callback on progress_bar, zero once settled
+    guint tick_id;
+} WindowBarAnimation;
+
+// Upper bound for popup windows, one per selected monitor
+#define WINDOW_MAX_VIEWS OSD_MONITOR_LIST_MAX
+
+// One layer-shell window and its widget tree, pinned to one monitor
+// Views are heap allocated so signal handlers can hold them across view list changes
 typedef struct {
-    // Final parsed arguments copied at startup
-    OSDArgs args;
-    // Latest sampled system or manual volume state
-    OSDVolumeState current_volume;
     // Root GTK window
     GtkWidget *window;
     // Overlay container for icon and mute slash
@@ -19,18 +172,75 @@ typedef struct {
     GtkWidget *icon_image;
     // Slash marker shown while muted
     GtkWidget *muted_slash;
-    // Progress bar for normalized volume fraction
+    // Snapshot volume bar, or GtkProgressBar when custom CSS styles the bar
     GtkWidget *progress_bar;
-    // Label widget showing percent or MUTED
+    // Cached-layout label showing percent or MUTED
     GtkWidget *percent_label;
-    // Base generated CSS provider
+    // Monitor the layer surface is pinned to, NULL lets the compositor choose
+    GdkMonitor *monitor;
+    // notify::geometry handler on monitor, zero while unpinned
+    gulong monitor_geometry_handler_id;
+    // Geometry behind the applied margins so repeated monitor events skip unchanged placement
+    WindowPlacementCache placement_cache;
+    // Widget outputs from the last render into this view
+    WindowRenderCache render_cache;
+    // Eases progress_bar between samples while the popup is visible
+    WindowBarAnimation bar_animation;
+    // A fullscreen client covers this view's monitor, so the view stays unmapped even while shown
+    bool suppressed;
+    // Window size at the last painted frame, zero until the first one
+    int painted_width;
+    int painted_height;
+} WindowView;
+
+// Shared runtime state for the GTK window flow
+typedef struct {
+    // Final parsed arguments copied at startup
+    OSDArgs args;
+    // Latest sampled system or manual volume state
+    OSDVolumeState current_volume;
+    // Popup windows fed by the one sampler, none while the release hide mode has torn them down
+    WindowView *views[WINDOW_MAX_VIEWS];
+    unsigned int view_count;
+    // Bundled icons per bucket at icon_size_px shared by every view, all NULL when the system theme is used
+    GdkPaintable *icon_paintables[OSD_ICON_BUCKET_COUNT];
+    // Display scoped providers below are installed once and style every view
+    // Static base stylesheet provider loaded from the embedded resource
     GtkCssProvider *css_provider;
-    // Optional user supplied CSS provider
+    // Generated provider defining only theme CSS variables
+    GtkCssProvider *theme_css_provider;
+    // Optional user supplied CSS provider, kept uninstalled while released as the fallback for a broken file
     GtkCssProvider *custom_css_provider;
     // Auto hide timeout source id
     guint timeout_source_id;
     // Watch poll timeout source id
     guint watch_source_id;
+    // SIGUSR1 source id used to dump runtime stats
+    guint stats_signal_source_id;
+    // Re-resolves args when the watched config file changes
+    OSDWindowReloadFn reload_fn;
+    // Opaque caller data passed back to reload_fn
+    void *reload_data;
+    // Monitor on the config file while watch mode runs
+    GFileMonitor *config_monitor;
+    // items-changed handler on the display monitor list
+    gulong monitors_changed_handler_id;
+    // Hyprland event socket read while following focus or fullscreen, valid only while hyprland_source_id is set
+    int hyprland_fd;
+    guint hyprland_source_id;
+    OSDHyprlandEventBuffer hyprland_events;
+    // Focused monitor and fullscreen workspaces learned from the event socket
+    OSDHyprlandState hyprland;
+    // Focus moved since the view was last pinned, so the next show looks the monitor up again
+    bool focus_pending;
+    // Debounce timer collapsing editor save bursts into one reload
+    guint config_reload_source_id;
+    // Monitor on the custom CSS file while watch mode runs
+    GFileMonitor *css_monitor;
+    // Pending rate limited custom CSS rebuild
+    guint css_reload_source_id;
+    // Clock value of the last custom CSS rebuild attempt
+    gint64 css_last_reload_us;
     // Slower poll interval used while popup is hidden
     unsigned int watch_idle_poll_ms;
     // Indicates app hold was acquired for watch mode
@@ -43,21 +253,137 @@ typedef struct {
     bool watch_query_failure_logged;
     // Non zero value forces process error exit
     int exit_code;
+    // Runtime counters for diagnostics
+    WindowRuntimeStats stats;
+    // Volume changed while hidden and widgets still show the old state
+    bool render_pending;
+    // Reports main loop stalls while watch mode runs
+    WindowWatchdog watchdog;
+    // Frame tick that will apply current_volume to a visible popup, zero when no sample is queued
+    guint sample_tick_id;
+    // Window carrying sample_tick_id, valid only while the id is set
+    GtkWidget *sample_tick_widget;
 } WindowState;
 
-// Applies compositor placement and layer shell geometry rules
-void window_apply_placement(WindowState *state);
-// Builds static widget tree for icon bar and label
-void window_build_widgets(WindowState *state);
+// Resolves the monitor selection into one monitor per view and returns the view count
+// Returned monitors carry a reference, and an entry is NULL when the display lists no monitors
+// or the focused monitor is not known yet, which leaves the choice to the compositor
+unsigned int window_resolve_monitors(const WindowState *state, GdkMonitor **out_monitors);
+// Applies compositor placement and layer shell geometry rules to one view
+void window_apply_placement(WindowState *state, WindowView *view);
+// Reapplies percent margins when the view's monitor geometry differs from the cached one
+// Returns true when placement was touched
+bool window_refresh_placement(WindowState *state, WindowView *view);
+// Builds static widget tree for icon bar and label in one view
+void window_build_widgets(WindowState *state, WindowView *view);
+// Loads bundled icon paintables for the current icon size and the largest view scale, or drops them
+void window_icons_prepare(WindowState *state);
+// Releases bundled icon paintables
+void window_icons_clear(WindowState *state);
 // Installs base and optional custom CSS providers
+// A custom file that fails to load leaves base and theme installed, plus the custom provider kept from a release
+// Returns false when nothing could be installed or the custom file failed with no earlier provider to fall back on
 bool window_init_css(WindowState *state);
 // Records fatal error and requests GTK shutdown
 void window_set_error(WindowState *state, const char *message);
+// Destroys every view, icons, and CSS providers, then trims the heap
+// Watch timers, monitors, and args stay alive so window_restore can rebuild
+void window_release(WindowState *state);
+// Rebuilds views, widgets, and CSS from args after window_release, no-op while views exist
+bool window_restore(WindowState *state);
+// Creates one view pinned to monitor, taking over the monitor reference
+WindowView *window_view_new(WindowState *state, GtkApplication *app, GdkMonitor *monitor);
+// Destroys one view's toplevel and drops its monitor
+void window_view_free(WindowView *view);
+// Replaces every view after a monitor selection change, keeping CSS providers and popup visibility
+void window_views_rebuild(WindowState *state);
 // Renders icon bar and label from current volume state
+// Only widgets whose output changed are touched, and hidden popups defer until shown
 void window_update_widgets(WindowState *state);
+// Renders a deferred update right before the popup becomes visible
+// The bar jumps straight to the sample here, so a show never waits on an animation
+void window_flush_widgets(WindowState *state);
+// Moves a view's bar to fraction, easing over a few frames when animate is set and the bar is on screen
+void window_bar_animation_set(WindowState *state, WindowView *view, double fraction, bool animate);
+// Drops a running animation and its tick callback, leaving the bar where it is
+void window_bar_animation_stop(WindowView *view);
+// Swaps base, theme variable, and custom CSS providers built from current args
+// Keeps the installed providers when a new one fails to build
+bool window_reload_css(WindowState *state);
+// Swaps only the theme variables provider for theme value changes
+bool window_reload_theme_css(WindowState *state);
+// Rebuilds only the custom CSS provider from args css_path and swaps it in on success
+// Keeps the installed provider when the file fails validation or parsing
+bool window_reload_custom_css(WindowState *state);
+// Derives idle poll interval to keep hidden watch loops low cost
+unsigned int window_compute_idle_watch_poll_ms(unsigned int active_poll_ms);
+// Re-arms pending watch and hide timers after interval changes
+bool window_runtime_retime(WindowState *state);
+// Moves a hidden popup between unmapped and transparent mapped states after a hide_mode change
+void window_runtime_apply_hide_mode(WindowState *state);
+// Brings views to the mapped, content, and fullscreen suppression state of the current popup visibility
+void window_runtime_sync_views(WindowState *state);
+// Arms or removes one shot timers through the active timer seam
+guint window_runtime_timeout_add(guint interval_ms, GSourceFunc callback, gpointer user_data);
+void window_runtime_remove_timer(guint *source_id);
+// Starts watching the config file for hot reload when a path is configured
+bool window_config_reload_install(WindowState *state);
+// Stops config monitoring and drops any pending debounced reload
+void window_config_reload_cleanup(WindowState *state);
+// Starts watching the custom CSS file for hot reload when a path is configured
+bool window_css_reload_install(WindowState *state);
+// Stops custom CSS monitoring and drops any pending rebuild
+void window_css_reload_cleanup(WindowState *state);
 // Activates watch mode polling and popup behavior
 bool window_activate_watch_mode(WindowState *state, GtkApplication *app);
 // Activates one shot popup behavior
 bool window_activate_single_popup(WindowState *state);
+// Removes pending popup and watch timers through the active timer seam
+void window_cancel_timers(WindowState *state);
+// Returns current time from the active clock seam in microseconds
+gint64 window_runtime_now_us(void);
+// Passing null restores the default GLib or wpctl backed implementation
+void window_runtime_set_clock_fn(WindowClockFn clock_fn);
+void window_runtime_set_volume_query_fn(WindowVolumeQueryFn query_fn);
+void window_runtime_set_timer_fns(WindowTimeoutAddFn timeout_add_fn, WindowSourceRemoveFn source_remove_fn);
+// Captures start time and baseline resources for diagnostics
+void window_stats_init(WindowState *state);
+// Writes one stats line with counters and current process resources
+void window_stats_write(const WindowState *state, FILE *out_stream);
+// Dumps stats on SIGUSR1 while watch mode is running
+bool window_stats_install_signal(WindowState *state);
+// Starts the stall watchdog thread, which sleeps until a tagged phase runs and logs it once it blocks too long
+bool window_watchdog_start(WindowState *state);
+void window_watchdog_stop(WindowState *state);
+// Tags main loop work for stall reports, nested phases count toward the outermost one
+void window_watchdog_enter(WindowState *state, WindowPhase phase);
+void window_watchdog_leave(WindowState *state);
+// Treats a late watch poll as dispatch latency and records it when no tagged stall explains it
+void window_watchdog_note_poll_latency(WindowState *state, gint64 latency_us);
+// Short stable name of a phase for logs and stats keys
+const char *window_phase_name(WindowPhase phase);
+// Times painted frames on a view's frame clock for the duration of each realization
+void window_stats_track_frames(WindowState *state, WindowView *view);
+// Keeps an empty input region and the card's opaque band on a view's surface for each realization
+void window_surface_track_regions(WindowView *view);
+// Reapplies input and opaque regions after changes that skip the layout phase, such as content opacity
+void window_surface_update_regions(WindowView *view);
+// Pins a view to monitor, taking over its reference, and follows that monitor's geometry
+// A NULL monitor unpins the view and drops the previous monitor, which is all view teardown needs
+void window_monitors_set_view_monitor(WindowState *state, WindowView *view, GdkMonitor *monitor);
+// Follows monitor hotplug so views move, appear, or go away without rebuilding the others
+void window_monitors_track(WindowState *state);
+void window_monitors_cleanup(WindowState *state);
+// Connects to or drops the Hyprland event socket as focus following or fullscreen suppression is turned on or off
+void window_hyprland_sync(WindowState *state);
+void window_hyprland_cleanup(WindowState *state);
+// Looks up the monitor behind the last focus event, NULL when unknown, with a reference for the caller
+GdkMonitor *window_focus_lookup_monitor(const WindowState *state);
+// Repins the popup to the focused monitor right before it is shown, a flag check when focus did not move
+void window_focus_apply(WindowState *state);
+// Recomputes which views sit on a monitor with a fullscreen client, true when any view changed
+bool window_fullscreen_update_views(WindowState *state);
+// True when suppress_fullscreen is on and every monitor the next show would use has a fullscreen client
+bool window_fullscreen_blocks_show(WindowState *state);
 
 #endif
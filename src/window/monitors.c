@@ -0,0 +1,164 @@
+#include "internal.h"
+
+// Geometry changes land per monitor, so only views pinned to that monitor are revisited
+static void window_monitors_on_geometry(GObject *object, GParamSpec *pspec, gpointer user_data) {
+    WindowState *state = user_data;
+
+    (void)pspec;
+    for (unsigned int index = 0U; index < state->view_count; index++) {
+        WindowView *view = state->views[index];
+
+        if ((GObject *)view->monitor == object && window_refresh_placement(state, view)) {
+            state->stats.placement_updates++;
+        }
+    }
+}
+
+void window_monitors_set_view_monitor(WindowState *state, WindowView *view, GdkMonitor *monitor) {
+    if (view->monitor != NULL) {
+        if (view->monitor_geometry_handler_id != 0U) {
+            g_signal_handler_disconnect(view->monitor, view->monitor_geometry_handler_id);
+            view->monitor_geometry_handler_id = 0U;
+        }
+        g_object_unref(view->monitor);
+    }
+
+    view->monitor = monitor;
+    view->placement_cache.valid = false;
+    if (monitor != NULL) {
+        view->monitor_geometry_handler_id =
+            g_signal_connect(monitor, "notify::geometry", G_CALLBACK(window_monitors_on_geometry), state);
+    }
+}
+
+// Returns the slot holding monitor among the first count entries, or count when absent
+static unsigned int window_monitors_find(GdkMonitor *const *monitors, unsigned int count, GdkMonitor *monitor) {
+    for (unsigned int index = 0U; index < count; index++) {
+        if (monitors[index] == monitor) {
+            return index;
+        }
+    }
+    return count;
+}
+
+// Matches views to the newly resolved monitors with as little churn as possible
+// Views whose monitor is still selected keep their surface and only revalidate cached margins,
+// views whose monitor went away are moved to a newly selected one, and only the remainder is built or destroyed
+static void window_monitors_sync(WindowState *state) {
+    GApplication *app = g_application_get_default();
+    GdkMonitor *monitors[WINDOW_MAX_VIEWS] = {NULL};
+    WindowView *matched[WINDOW_MAX_VIEWS] = {NULL};
+    WindowView *spare[WINDOW_MAX_VIEWS] = {NULL};
+    unsigned int spare_count = 0U;
+    unsigned int count = 0U;
+    unsigned int view_count = 0U;
+    bool added = false;
+
+    count = window_resolve_monitors(state, monitors);
+    for (unsigned int index = 0U; index < state->view_count; index++) {
+        WindowView *view = state->views[index];
+        const unsigned int slot = window_monitors_find(monitors, count, view->monitor);
+
+        if (slot == count || matched[slot] != NULL) {
+            spare[spare_count] = view;
+            spare_count++;
+            continue;
+        }
+        matched[slot] = view;
+        if (monitors[slot] != NULL) {
+            // The view already holds its own reference
+            g_object_unref(monitors[slot]);
+        }
+        if (window_refresh_placement(state, view)) {
+            state->stats.placement_updates++;
+        }
+    }
+
+    for (unsigned int slot = 0U; slot < count; slot++) {
+        if (matched[slot] != NULL) {
+            continue;
+        }
+        if (spare_count > 0U) {
+            // Repinning an existing window is a placement change, its widgets and styling stay as they are
+            spare_count--;
+            matched[slot] = spare[spare_count];
+            window_monitors_set_view_monitor(state, matched[slot], monitors[slot]);
+            window_apply_placement(state, matched[slot]);
+            state->stats.placement_updates++;
+        } else if (app != NULL) {
+            // A new view's scale-factor notification reloads shared icons if it is the densest monitor
+            matched[slot] = window_view_new(state, GTK_APPLICATION(app), monitors[slot]);
+            added = true;
+        } else if (monitors[slot] != NULL) {
+            g_object_unref(monitors[slot]);
+        }
+    }
+
+    for (unsigned int index = 0U; index < spare_count; index++) {
+        window_view_free(spare[index]);
+    }
+    for (unsigned int slot = 0U; slot < count; slot++) {
+        if (matched[slot] != NULL) {
+            state->views[view_count] = matched[slot];
+            view_count++;
+        }
+    }
+    for (unsigned int index = view_count; index < WINDOW_MAX_VIEWS; index++) {
+        state->views[index] = NULL;
+    }
+    state->view_count = view_count;
+
+    if (added) {
+        window_runtime_sync_views(state);
+    }
+}
+
+// Display monitor list callback for hotplug, docking, and output reconfiguration
+static void window_monitors_on_items_changed(
+    GListModel *list,
+    guint position,
+    guint removed,
+    guint added,
+    gpointer user_data
+) {
+    WindowState *state = user_data;
+
+    (void)list;
+    (void)position;
+    (void)removed;
+    (void)added;
+    state->stats.monitor_changes++;
+    if (state->view_count == 0U) {
+        // Released popups resolve monitors afresh when they are rebuilt
+        return;
+    }
+    window_monitors_sync(state);
+}
+
+void window_monitors_track(WindowState *state) {
+    GdkDisplay *display = gdk_display_get_default();
+
+    if (state->monitors_changed_handler_id != 0U || display == NULL) {
+        return;
+    }
+
+    state->monitors_changed_handler_id = g_signal_connect(
+        gdk_display_get_monitors(display),
+        "items-changed",
+        G_CALLBACK(window_monitors_on_items_changed),
+        state
+    );
+}
+
+void window_monitors_cleanup(WindowState *state) {
+    GdkDisplay *display = gdk_display_get_default();
+
+    if (state->monitors_changed_handler_id == 0U) {
+        return;
+    }
+
+    if (display != NULL) {
+        g_signal_handler_disconnect(gdk_display_get_monitors(display), state->monitors_changed_handler_id);
+    }
+    state->monitors_changed_handler_id = 0U;
+}
@@ -0,0 +1,187 @@
+#include "window/percent_label.h"
+
+#include <string.h>
+
+// "0%" through "200%" followed by one slot for "MUTED"
+#define WINDOW_PERCENT_LABEL_MAX_PERCENT 200
+#define WINDOW_PERCENT_LABEL_MUTED_INDEX (WINDOW_PERCENT_LABEL_MAX_PERCENT + 1)
+#define WINDOW_PERCENT_LABEL_TEXT_COUNT (WINDOW_PERCENT_LABEL_MUTED_INDEX + 1)
+
+struct _WindowPercentLabel {
+    GtkWidget parent_instance;
+    // Index of the shown string in layouts
+    int text_index;
+    // Shaped layouts, shared font and attributes, each created the first time its string is measured or drawn
+    PangoLayout *layouts[WINDOW_PERCENT_LABEL_TEXT_COUNT];
+    // Pango context serial the cache was shaped against
+    guint context_serial;
+    // Logical extent of the widest and tallest string the label can show
+    int max_width;
+    int max_height;
+    bool cache_ready;
+};
+
+G_DEFINE_FINAL_TYPE(WindowPercentLabel, window_percent_label, GTK_TYPE_WIDGET)
+
+// Writes the text for one cache slot
+static void window_percent_label_format(int text_index, char *out_text, size_t out_size) {
+    if (text_index == WINDOW_PERCENT_LABEL_MUTED_INDEX) {
+        (void)g_strlcpy(out_text, "MUTED", out_size);
+        return;
+    }
+    (void)g_snprintf(out_text, out_size, "%d%%", text_index);
+}
+
+static void window_percent_label_drop_cache(WindowPercentLabel *self) {
+    for (size_t index = 0U; index < G_N_ELEMENTS(self->layouts); index++) {
+        g_clear_object(&self->layouts[index]);
+    }
+    self->max_width = 0;
+    self->max_height = 0;
+    self->cache_ready = false;
+}
+
+// Returns the layout for one string, shaping it on first use
+static PangoLayout *window_percent_label_layout(WindowPercentLabel *self, int text_index) {
+    char text[8];
+
+    if (self->layouts[text_index] == NULL) {
+        window_percent_label_format(text_index, text, sizeof(text));
+        self->layouts[text_index] = pango_layout_new(gtk_widget_get_pango_context(GTK_WIDGET(self)));
+        pango_layout_set_text(self->layouts[text_index], text, -1);
+    }
+    return self->layouts[text_index];
+}
+
+static void window_percent_label_include_extent(WindowPercentLabel *self, int text_index) {
+    PangoRectangle logical;
+
+    pango_layout_get_pixel_extents(window_percent_label_layout(self, text_index), NULL, &logical);
+    self->max_width = MAX(self->max_width, logical.width);
+    self->max_height = MAX(self->max_height, logical.height);
+}
+
+// Drops the layouts whenever the widget context serial changes, which CSS font changes do, then sizes the label
+// Only "1dd%" with d the widest digit, "200%", and "MUTED" can be widest, so a show shapes four strings, not 202
+static void window_percent_label_ensure_cache(WindowPercentLabel *self) {
+    PangoContext *context = gtk_widget_get_pango_context(GTK_WIDGET(self));
+    const guint serial = pango_context_get_serial(context);
+    PangoLayout *digits = NULL;
+    PangoRectangle position;
+    int widest_digit = 0;
+    int widest_advance = -1;
+
+    if (self->cache_ready && self->context_serial == serial) {
+        return;
+    }
+
+    window_percent_label_drop_cache(self);
+    self->context_serial = serial;
+    self->cache_ready = true;
+
+    // One shaped run of all ten digits gives each digit's advance in the current font
+    digits = pango_layout_new(context);
+    pango_layout_set_text(digits, "0123456789", -1);
+    for (int digit = 0; digit < 10; digit++) {
+        pango_layout_index_to_pos(digits, digit, &position);
+        if (position.width > widest_advance) {
+            widest_advance = position.width;
+            widest_digit = digit;
+        }
+    }
+    g_object_unref(digits);
+
+    window_percent_label_include_extent(self, 100 + widest_digit * 11);
+    window_percent_label_include_extent(self, WINDOW_PERCENT_LABEL_MAX_PERCENT);
+    window_percent_label_include_extent(self, WINDOW_PERCENT_LABEL_MUTED_INDEX);
+}
+
+static void window_percent_label_measure(
+    GtkWidget *widget,
+    GtkOrientation orientation,
+    int for_size,
+    int *minimum,
+    int *natural,
+    int *minimum_baseline,
+    int *natural_baseline
+) {
+    WindowPercentLabel *self = WINDOW_PERCENT_LABEL(widget);
+    int extent = 0;
+
+    (void)for_size;
+    window_percent_label_ensure_cache(self);
+    // Widest string for every value keeps allocation constant across changes
+    extent = (orientation == GTK_ORIENTATION_HORIZONTAL) ? self->max_width : self->max_height;
+    *minimum = extent;
+    *natural = extent;
+    *minimum_baseline = -1;
+    *natural_baseline = -1;
+}
+
+static void window_percent_label_snapshot(GtkWidget *widget, GtkSnapshot *snapshot) {
+    WindowPercentLabel *self = WINDOW_PERCENT_LABEL(widget);
+    PangoLayout *layout = NULL;
+    PangoRectangle logical;
+    graphene_point_t origin;
+    GdkRGBA color;
+
+    window_percent_label_ensure_cache(self);
+    layout = window_percent_label_layout(self, self->text_index);
+    pango_layout_get_pixel_extents(layout, NULL, &logical);
+    gtk_widget_get_color(widget, &color);
+
+    // Centered like the GtkLabel it replaces with xalign 0.5
+    graphene_point_init(
+        &origin,
+        (float)(gtk_widget_get_width(widget) - logical.width) / 2.0F,
+        (float)(gtk_widget_get_height(widget) - logical.height) / 2.0F
+    );
+    gtk_snapshot_save(snapshot);
+    gtk_snapshot_translate(snapshot, &origin);
+    gtk_snapshot_append_layout(snapshot, layout, &color);
+    gtk_snapshot_restore(snapshot);
+}
+
+static void window_percent_label_dispose(GObject *object) {
+    window_percent_label_drop_cache(WINDOW_PERCENT_LABEL(object));
+    G_OBJECT_CLASS(window_percent_label_parent_class)->dispose(object);
+}
+
+static void window_percent_label_class_init(WindowPercentLabelClass *klass) {
+    GObjectClass *object_class = G_OBJECT_CLASS(klass);
+    GtkWidgetClass *widget_class = GTK_WIDGET_CLASS(klass);
+
+    object_class->dispose = window_percent_label_dispose;
+    widget_class->measure = window_percent_label_measure;
+    widget_class->snapshot = window_percent_label_snapshot;
+    // Keeps "label" selectors in user stylesheets matching
+    gtk_widget_class_set_css_name(widget_class, "label");
+    gtk_widget_class_set_accessible_role(widget_class, GTK_ACCESSIBLE_ROLE_LABEL);
+}
+
+static void window_percent_label_init(WindowPercentLabel *self) {
+    self->text_index = 0;
+    gtk_accessible_update_property(GTK_ACCESSIBLE(self), GTK_ACCESSIBLE_PROPERTY_LABEL, "0%", -1);
+}
+
+GtkWidget *window_percent_label_new(void) {
+    return g_object_new(WINDOW_TYPE_PERCENT_LABEL, NULL);
+}
+
+void window_percent_label_set_value(WindowPercentLabel *self, int percent, bool muted) {
+    char text[8];
+    int text_index = 0;
+
+    g_return_if_fail(WINDOW_IS_PERCENT_LABEL(self));
+
+    text_index = muted ? WINDOW_PERCENT_LABEL_MUTED_INDEX : CLAMP(percent, 0, WINDOW_PERCENT_LABEL_MAX_PERCENT);
+    if (self->text_index == text_index) {
+        return;
+    }
+
+    self->text_index = text_index;
+    window_percent_label_format(text_index, text, sizeof(text));
+    gtk_accessible_update_property(GTK_ACCESSIBLE(self), GTK_ACCESSIBLE_PROPERTY_LABEL, text, -1);
+    // Layout swap, shaping only a string never shown before and never resizing
+    gtk_widget_queue_draw(GTK_WIDGET(self));
+}
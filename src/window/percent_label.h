@@ -0,0 +1,16 @@
+#ifndef WINDOW_PERCENT_LABEL_H
+#define WINDOW_PERCENT_LABEL_H
+
+#include <gtk/gtk.h>
+#include <stdbool.h>
+
+// Percent or MUTED text drawn from a cache of layouts shaped on first use
+// Size is the widest string it can show, so value changes only ever redraw
+#define WINDOW_TYPE_PERCENT_LABEL (window_percent_label_get_type())
+G_DECLARE_FINAL_TYPE(WindowPercentLabel, window_percent_label, WINDOW, PERCENT_LABEL, GtkWidget)
+
+GtkWidget *window_percent_label_new(void);
+// Shows MUTED when muted, otherwise percent clamped to 0-200, and queues a draw when the text changes
+void window_percent_label_set_value(WindowPercentLabel *self, int percent, bool muted);
+
+#endif
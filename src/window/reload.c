@@ -0,0 +1,402 @@
+#include "internal.h"
+
+#include <string.h>
+
+// Quiet period after the last file event before a reload runs
+#define OSD_CONFIG_RELOAD_DEBOUNCE_MS 250U
+// Custom CSS settles faster since only one provider is rebuilt
+#define OSD_CSS_RELOAD_DEBOUNCE_MS 150U
+// Floor between two CSS rebuilds so editors that save continuously cannot storm restyling
+#define OSD_CSS_RELOAD_MIN_INTERVAL_MS 500U
+
+// Parts of the running window that a config change must touch
+typedef enum {
+    WINDOW_RELOAD_NONE = 0U,
+    WINDOW_RELOAD_TIMERS = 1U << 0U,
+    WINDOW_RELOAD_CSS = 1U << 1U,
+    WINDOW_RELOAD_PLACEMENT = 1U << 2U,
+    WINDOW_RELOAD_REBUILD = 1U << 3U,
+    WINDOW_RELOAD_RESTART = 1U << 4U,
+    // Theme values only, served by the variables provider alone
+    WINDOW_RELOAD_THEME_CSS = 1U << 5U,
+    WINDOW_RELOAD_HIDE_MODE = 1U << 6U,
+    // Monitor selection, which decides how many views exist and where
+    WINDOW_RELOAD_VIEWS = 1U << 7U,
+    // Hyprland event following, needed by focused monitor selection and fullscreen suppression
+    WINDOW_RELOAD_HYPRLAND = 1U << 8U
+} WindowReloadChange;
+
+// Selections compare by meaning, so list order matters but unused index slots do not
+static bool window_reload_monitors_equal(const OSDMonitorSelection *a, const OSDMonitorSelection *b) {
+    if (a->all != b->all || a->focused != b->focused || a->count != b->count) {
+        return false;
+    }
+    for (unsigned int index = 0U; index < a->count && index < OSD_MONITOR_LIST_MAX; index++) {
+        if (a->indices[index] != b->indices[index]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Classifies which runtime pieces differ between running and reloaded args
+static unsigned int window_reload_diff(const OSDArgs *current, const OSDArgs *next) {
+    const OSDTheme *a = &current->theme;
+    const OSDTheme *b = &next->theme;
+    unsigned int changes = WINDOW_RELOAD_NONE;
+
+    if (current->timeout_ms != next->timeout_ms || current->watch_poll_ms != next->watch_poll_ms) {
+        changes |= WINDOW_RELOAD_TIMERS;
+    }
+
+    if (current->hide_mode != next->hide_mode) {
+        changes |= WINDOW_RELOAD_HIDE_MODE;
+    }
+
+    // Size feeds both theme variables and percent placement margins
+    if (a->width_px != b->width_px || a->height_px != b->height_px) {
+        changes |= WINDOW_RELOAD_THEME_CSS | WINDOW_RELOAD_PLACEMENT;
+    }
+
+    if (!window_reload_monitors_equal(&current->monitors, &next->monitors)) {
+        changes |= WINDOW_RELOAD_VIEWS | WINDOW_RELOAD_HYPRLAND;
+    }
+
+    if (current->suppress_fullscreen != next->suppress_fullscreen) {
+        changes |= WINDOW_RELOAD_HYPRLAND;
+    }
+
+    if (a->anchor != b->anchor ||
+        a->margin_x_px != b->margin_x_px || a->margin_y_px != b->margin_y_px ||
+        a->x_percent != b->x_percent || a->y_percent != b->y_percent) {
+        changes |= WINDOW_RELOAD_PLACEMENT;
+    }
+
+    if (current->css_replace != next->css_replace || current->css_path_set != next->css_path_set ||
+        strcmp(current->css_path, next->css_path) != 0) {
+        changes |= WINDOW_RELOAD_CSS;
+    }
+
+    if (a->corner_radius_px != b->corner_radius_px || a->icon_size_px != b->icon_size_px ||
+        a->font_size_px != b->font_size_px || strcmp(a->background_color, b->background_color) != 0 ||
+        strcmp(a->border_color, b->border_color) != 0 || strcmp(a->fill_color, b->fill_color) != 0 ||
+        strcmp(a->track_color, b->track_color) != 0 || strcmp(a->text_color, b->text_color) != 0 ||
+        strcmp(a->icon_color, b->icon_color) != 0) {
+        changes |= WINDOW_RELOAD_THEME_CSS;
+    }
+
+    // Orientation, bar paints, and card decoration are baked into widgets, and stylesheet selection picks them
+    if (a->vertical_layout != b->vertical_layout || strcmp(a->fill_color, b->fill_color) != 0 ||
+        strcmp(a->track_color, b->track_color) != 0 || strcmp(a->background_color, b->background_color) != 0 ||
+        strcmp(a->border_color, b->border_color) != 0 || a->corner_radius_px != b->corner_radius_px ||
+        current->css_replace != next->css_replace || current->css_path_set != next->css_path_set ||
+        a->system_icons != b->system_icons) {
+        changes |= WINDOW_RELOAD_REBUILD;
+    }
+
+    // Mode and source switches change the runtime shape and need a restart
+    if (current->watch_mode != next->watch_mode || current->use_system_volume != next->use_system_volume ||
+        current->config_path_set != next->config_path_set || strcmp(current->config_path, next->config_path) != 0) {
+        changes |= WINDOW_RELOAD_RESTART;
+    }
+
+    return changes;
+}
+
+// Re-resolves args and applies only the pieces that changed
+static void window_config_reload_apply(WindowState *state) {
+    OSDArgs previous_args;
+    OSDArgs next_args;
+    unsigned int changes = WINDOW_RELOAD_NONE;
+    bool css_path_changed = false;
+    bool styled = true;
+
+    if (!state->reload_fn(&next_args, stderr, state->reload_data)) {
+        g_printerr("Config reload failed; keeping previous settings\n");
+        return;
+    }
+
+    previous_args = state->args;
+    changes = window_reload_diff(&previous_args, &next_args);
+    if ((changes & WINDOW_RELOAD_RESTART) != 0U) {
+        g_printerr("Config change to watch_mode, use_system_volume, or config path requires a restart; ignoring it\n");
+        next_args.watch_mode = previous_args.watch_mode;
+        next_args.use_system_volume = previous_args.use_system_volume;
+        next_args.config_path_set = previous_args.config_path_set;
+        memcpy(next_args.config_path, previous_args.config_path, sizeof(next_args.config_path));
+    }
+    // Sampled volume and help flag are runtime state not config state
+    next_args.volume = previous_args.volume;
+    next_args.show_help = previous_args.show_help;
+
+    if ((changes & ~(unsigned int)WINDOW_RELOAD_RESTART) == WINDOW_RELOAD_NONE) {
+        return;
+    }
+
+    state->args = next_args;
+    css_path_changed = previous_args.css_path_set != state->args.css_path_set ||
+                       strcmp(previous_args.css_path, state->args.css_path) != 0;
+    if (state->view_count == 0U) {
+        // Released popup rebuilds styling, views, widgets, and placement from args on its next show
+        changes &= (unsigned int)(WINDOW_RELOAD_TIMERS | WINDOW_RELOAD_HIDE_MODE | WINDOW_RELOAD_HYPRLAND);
+        if (css_path_changed) {
+            // The kept custom provider belongs to the old file and is no fallback for the new one
+            g_clear_object(&state->custom_css_provider);
+        }
+    }
+
+    if ((changes & WINDOW_RELOAD_CSS) != 0U) {
+        // Stylesheet selection changed so every provider is rebuilt together
+        styled = window_reload_css(state);
+    } else if ((changes & WINDOW_RELOAD_THEME_CSS) != 0U) {
+        styled = window_reload_theme_css(state);
+    }
+    if (!styled) {
+        // Providers are swapped last so a broken style rolls back cleanly
+        state->args = previous_args;
+        g_printerr("Config reload produced invalid styling; keeping previous settings\n");
+        return;
+    }
+
+    if (css_path_changed) {
+        // Follow css_file to its new path so later edits keep hot reloading
+        window_css_reload_cleanup(state);
+        if (!window_css_reload_install(state)) {
+            g_printerr("Failed to watch custom CSS file for changes; continuing without CSS hot reload\n");
+        }
+    }
+
+    if ((changes & WINDOW_RELOAD_HYPRLAND) != 0U) {
+        // Connected first so views built below can resolve the focused monitor
+        window_hyprland_sync(state);
+    }
+    if ((changes & WINDOW_RELOAD_VIEWS) != 0U) {
+        // Fresh views pick up placement, widgets, and icons from the new args as they are built
+        window_views_rebuild(state);
+        changes &= ~(unsigned int)(WINDOW_RELOAD_REBUILD | WINDOW_RELOAD_PLACEMENT);
+    }
+    if ((changes & WINDOW_RELOAD_HYPRLAND) != 0U && window_fullscreen_update_views(state)) {
+        // Suppression was switched on or off over a fullscreen client
+        window_runtime_sync_views(state);
+    }
+
+    if ((changes & WINDOW_RELOAD_REBUILD) != 0U) {
+        // Orientation is baked into box and bar widgets at construction
+        for (unsigned int index = 0U; index < state->view_count; index++) {
+            window_build_widgets(state, state->views[index]);
+        }
+        window_icons_prepare(state);
+        window_update_widgets(state);
+    } else if ((changes & WINDOW_RELOAD_THEME_CSS) != 0U) {
+        // Icon pixel size is a widget property outside the stylesheet
+        for (unsigned int index = 0U; index < state->view_count; index++) {
+            gtk_image_set_pixel_size(GTK_IMAGE(state->views[index]->icon_image), (int)state->args.theme.icon_size_px);
+        }
+        if (previous_args.theme.icon_size_px != state->args.theme.icon_size_px) {
+            // Bundled paintables are rasterized for one size
+            window_icons_prepare(state);
+            for (unsigned int index = 0U; index < state->view_count; index++) {
+                state->views[index]->render_cache.valid = false;
+            }
+            window_update_widgets(state);
+        }
+    }
+
+    if ((changes & WINDOW_RELOAD_PLACEMENT) != 0U) {
+        for (unsigned int index = 0U; index < state->view_count; index++) {
+            window_apply_placement(state, state->views[index]);
+        }
+    }
+
+    if ((changes & WINDOW_RELOAD_HIDE_MODE) != 0U) {
+        window_runtime_apply_hide_mode(state);
+    }
+
+    if ((changes & WINDOW_RELOAD_TIMERS) != 0U) {
+        state->watch_idle_poll_ms = window_compute_idle_watch_poll_ms(state->args.watch_poll_ms);
+        if (!window_runtime_retime(state)) {
+            return;
+        }
+    }
+
+    g_printerr("Config reloaded\n");
+}
+
+// Debounce expiry runs one reload for a whole burst of file events
+static gboolean window_on_config_reload_due(gpointer user_data) {
+    WindowState *state = user_data;
+
+    state->config_reload_source_id = 0U;
+    // Covers the file read and parse as well as every CSS, view, and widget change the reload applies
+    window_watchdog_enter(state, WINDOW_PHASE_CONFIG);
+    window_config_reload_apply(state);
+    window_watchdog_leave(state);
+    return G_SOURCE_REMOVE;
+}
+
+// Metadata only events never change file content
+static bool window_reload_event_changes_content(GFileMonitorEvent event_type) {
+    return event_type != G_FILE_MONITOR_EVENT_ATTRIBUTE_CHANGED && event_type != G_FILE_MONITOR_EVENT_PRE_UNMOUNT &&
+           event_type != G_FILE_MONITOR_EVENT_UNMOUNTED;
+}
+
+// Watching moves catches editors that save through a rename into place
+static GFileMonitor *window_reload_monitor_path(const char *path, const char *label) {
+    GFile *file = g_file_new_for_path(path);
+    GError *error = NULL;
+    GFileMonitor *monitor = g_file_monitor_file(file, G_FILE_MONITOR_WATCH_MOVES, NULL, &error);
+
+    g_object_unref(file);
+    if (monitor == NULL && error != NULL) {
+        g_printerr("%s watch error: %s\n", label, error->message);
+        g_error_free(error);
+    }
+    return monitor;
+}
+
+// File monitor callback restarts the debounce window on every relevant event
+static void window_on_config_changed(
+    GFileMonitor *monitor,
+    GFile *file,
+    GFile *other_file,
+    GFileMonitorEvent event_type,
+    gpointer user_data
+) {
+    WindowState *state = user_data;
+
+    (void)monitor;
+    (void)file;
+    (void)other_file;
+
+    if (!window_reload_event_changes_content(event_type)) {
+        return;
+    }
+
+    // Editors often truncate write and rename in quick succession
+    window_runtime_remove_timer(&state->config_reload_source_id);
+    state->config_reload_source_id =
+        window_runtime_timeout_add(OSD_CONFIG_RELOAD_DEBOUNCE_MS, window_on_config_reload_due, state);
+}
+
+bool window_config_reload_install(WindowState *state) {
+    if (state == NULL) {
+        return false;
+    }
+    if (state->reload_fn == NULL || !state->args.config_path_set || state->config_monitor != NULL) {
+        // Nothing to watch is not an error
+        return true;
+    }
+
+    state->config_monitor = window_reload_monitor_path(state->args.config_path, "Config");
+    if (state->config_monitor == NULL) {
+        return false;
+    }
+
+    g_signal_connect(state->config_monitor, "changed", G_CALLBACK(window_on_config_changed), state);
+    return true;
+}
+
+void window_config_reload_cleanup(WindowState *state) {
+    if (state == NULL) {
+        return;
+    }
+
+    window_runtime_remove_timer(&state->config_reload_source_id);
+    if (state->config_monitor != NULL) {
+        g_file_monitor_cancel(state->config_monitor);
+        g_clear_object(&state->config_monitor);
+    }
+}
+
+// Rebuild runs from the main loop after the quiet period, never inside a poll or input handler
+static gboolean window_on_css_reload_due(gpointer user_data) {
+    WindowState *state = user_data;
+    bool styled = false;
+
+    state->css_reload_source_id = 0U;
+    if (state->view_count == 0U) {
+        // Released popup reads the file again when it is rebuilt
+        return G_SOURCE_REMOVE;
+    }
+    state->css_last_reload_us = window_runtime_now_us();
+    window_watchdog_enter(state, WINDOW_PHASE_CSS);
+    styled = window_reload_custom_css(state);
+    window_watchdog_leave(state);
+    if (!styled) {
+        g_printerr("Custom CSS reload failed; keeping previous style\n");
+        return G_SOURCE_REMOVE;
+    }
+
+    g_printerr("Custom CSS reloaded\n");
+    return G_SOURCE_REMOVE;
+}
+
+// Trailing debounce, stretched so two rebuilds are never closer than the minimum interval
+static guint window_css_reload_delay_ms(const WindowState *state) {
+    gint64 next_allowed_us = 0;
+    gint64 now_us = 0;
+    gint64 wait_ms = 0;
+
+    if (state->css_last_reload_us == 0) {
+        return OSD_CSS_RELOAD_DEBOUNCE_MS;
+    }
+
+    now_us = window_runtime_now_us();
+    next_allowed_us = state->css_last_reload_us + (gint64)OSD_CSS_RELOAD_MIN_INTERVAL_MS * G_TIME_SPAN_MILLISECOND;
+    wait_ms = (next_allowed_us - now_us + G_TIME_SPAN_MILLISECOND - 1) / G_TIME_SPAN_MILLISECOND;
+    if (wait_ms <= (gint64)OSD_CSS_RELOAD_DEBOUNCE_MS) {
+        return OSD_CSS_RELOAD_DEBOUNCE_MS;
+    }
+    return (guint)wait_ms;
+}
+
+static void window_on_css_changed(
+    GFileMonitor *monitor,
+    GFile *file,
+    GFile *other_file,
+    GFileMonitorEvent event_type,
+    gpointer user_data
+) {
+    WindowState *state = user_data;
+
+    (void)monitor;
+    (void)file;
+    (void)other_file;
+
+    if (!window_reload_event_changes_content(event_type)) {
+        return;
+    }
+
+    window_runtime_remove_timer(&state->css_reload_source_id);
+    state->css_reload_source_id =
+        window_runtime_timeout_add(window_css_reload_delay_ms(state), window_on_css_reload_due, state);
+}
+
+bool window_css_reload_install(WindowState *state) {
+    if (state == NULL) {
+        return false;
+    }
+    if (!state->args.css_path_set || state->css_monitor != NULL) {
+        return true;
+    }
+
+    state->css_monitor = window_reload_monitor_path(state->args.css_path, "Custom CSS");
+    if (state->css_monitor == NULL) {
+        return false;
+    }
+
+    g_signal_connect(state->css_monitor, "changed", G_CALLBACK(window_on_css_changed), state);
+    return true;
+}
+
+void window_css_reload_cleanup(WindowState *state) {
+    if (state == NULL) {
+        return;
+    }
+
+    window_runtime_remove_timer(&state->css_reload_source_id);
+    if (state->css_monitor != NULL) {
+        g_file_monitor_cancel(state->css_monitor);
+        g_clear_object(&state->css_monitor);
+    }
+}
@@ -1,67 +1,80 @@
 #include "internal.h"
 
 #include "style/style.h"
+#include "window/percent_label.h"
 
 #include <glib.h>
 #include <stddef.h>
 
 // Applies muted state classes and slash visibility in one place
-static void window_apply_muted_css(WindowState *state, bool is_muted) {
-    g_return_if_fail(state != NULL);
-    g_return_if_fail(state->percent_label != NULL);
+static void window_apply_muted_css(WindowView *view, bool is_muted) {
+    g_return_if_fail(view != NULL);
+    g_return_if_fail(view->percent_label != NULL);
 
-    if (state->muted_slash != NULL) {
+    if (view->muted_slash != NULL) {
         // Slash stays hidden until mute is active
-        gtk_widget_set_visible(state->muted_slash, is_muted);
+        gtk_widget_set_visible(view->muted_slash, is_muted);
     }
 
     if (is_muted) {
         // Muted class drives label color from CSS
-        gtk_widget_add_css_class(state->percent_label, "muted");
+        gtk_widget_add_css_class(view->percent_label, "muted");
         return;
     }
 
-    gtk_widget_remove_css_class(state->percent_label, "muted");
+    gtk_widget_remove_css_class(view->percent_label, "muted");
 }
 
-// Writes percent label text using bounded formatting and explicit truncation checks
-static void window_format_percent_text(char *out_text, size_t out_text_size, bool is_muted, int clamped_percent) {
-    int written = 0;
-
-    if (out_text == NULL || out_text_size == 0U) {
-        return;
+// Pushes only changed outputs into one view's widgets and records them in its render cache
+static void window_render_view(
+    WindowState *state,
+    WindowView *view,
+    OSDIconBucket icon_bucket,
+    double fraction,
+    int clamped_percent,
+    bool is_muted,
+    bool animate
+) {
+    WindowRenderCache *cache = &view->render_cache;
+
+    g_return_if_fail(view->icon_image != NULL);
+    g_return_if_fail(view->progress_bar != NULL);
+    g_return_if_fail(view->percent_label != NULL);
+
+    // Each setter below can invalidate style or queue a resize, so equal outputs are skipped
+    if (!cache->valid || cache->icon_bucket != icon_bucket) {
+        if (state->icon_paintables[icon_bucket] != NULL) {
+            // Preloaded paintable swap skips icon theme lookup entirely
+            gtk_image_set_from_paintable(GTK_IMAGE(view->icon_image), state->icon_paintables[icon_bucket]);
+        } else {
+            gtk_image_set_from_icon_name(GTK_IMAGE(view->icon_image), osd_style_icon_name_for_bucket(icon_bucket));
+        }
+        cache->icon_bucket = icon_bucket;
     }
-
-    if (is_muted) {
-        written = g_snprintf(out_text, out_text_size, "MUTED");
-    } else {
-        written = g_snprintf(out_text, out_text_size, "%d%%", clamped_percent);
+    if (!cache->valid || cache->muted != is_muted) {
+        window_apply_muted_css(view, is_muted);
+        cache->muted = is_muted;
     }
-
-    if (written < 0) {
-        out_text[0] = '\0';
-        return;
+    // Fractions come from integer percents so exact comparison is stable
+    if (!cache->valid || cache->fraction != fraction) {
+        // Freshly built bars hold a placeholder, so there is nothing meaningful to ease from
+        window_bar_animation_set(state, view, fraction, animate && cache->valid);
+        cache->fraction = fraction;
     }
+    // Label keeps its own shaped text cache, muted view shows status text instead of percent
+    window_percent_label_set_value(WINDOW_PERCENT_LABEL(view->percent_label), clamped_percent, is_muted);
 
-    if ((size_t)written >= out_text_size) {
-        out_text[out_text_size - 1U] = '\0';
-    }
+    cache->valid = true;
 }
 
-// Syncs icon, bar, and text from current sampled volume state
-void window_update_widgets(WindowState *state) {
-    char percent_text[16];
-    const char *icon_name = NULL;
+// Derives outputs once from the sample and fans them out to every view
+static void window_render_widgets(WindowState *state, bool animate) {
+    OSDIconBucket icon_bucket = OSD_ICON_BUCKET_MUTED;
     double fraction = 0.0;
     int clamped_percent = 0;
     OSDVolumeState normalized_volume;
     bool is_muted = false;
 
-    g_return_if_fail(state != NULL);
-    g_return_if_fail(state->icon_image != NULL);
-    g_return_if_fail(state->progress_bar != NULL);
-    g_return_if_fail(state->percent_label != NULL);
-
     clamped_percent = state->current_volume.volume_percent;
     is_muted = state->current_volume.muted;
 
@@ -75,13 +88,10 @@ void window_update_widgets(WindowState *state) {
     normalized_volume = state->current_volume;
     normalized_volume.volume_percent = clamped_percent;
 
-    icon_name = osd_style_icon_name_for_state(&normalized_volume);
     // Icon selection uses normalized volume range for stable buckets
-    gtk_image_set_from_icon_name(GTK_IMAGE(state->icon_image), icon_name);
+    icon_bucket = osd_style_icon_bucket_for_state(&normalized_volume);
 
     fraction = (double)clamped_percent / 100.0;
-    // Muted view shows status text instead of percent
-    window_format_percent_text(percent_text, sizeof(percent_text), is_muted, clamped_percent);
 
     if (fraction < 0.0) {
         fraction = 0.0;
@@ -91,7 +101,33 @@ void window_update_widgets(WindowState *state) {
         fraction = 1.0;
     }
 
-    window_apply_muted_css(state, is_muted);
-    gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(state->progress_bar), fraction);
-    gtk_label_set_text(GTK_LABEL(state->percent_label), percent_text);
+    window_watchdog_enter(state, WINDOW_PHASE_RENDER);
+    for (unsigned int index = 0U; index < state->view_count; index++) {
+        window_render_view(state, state->views[index], icon_bucket, fraction, clamped_percent, is_muted, animate);
+    }
+    window_watchdog_leave(state);
+    state->render_pending = false;
+}
+
+// Syncs icon, bar, and text from current sampled volume state
+void window_update_widgets(WindowState *state) {
+    g_return_if_fail(state != NULL);
+
+    if (!state->popup_visible || state->view_count == 0U) {
+        // Hidden or released widgets are never seen, so baseline samples and idle changes cost nothing
+        state->render_pending = true;
+        return;
+    }
+
+    window_render_widgets(state, true);
+}
+
+void window_flush_widgets(WindowState *state) {
+    g_return_if_fail(state != NULL);
+
+    if (!state->render_pending || state->view_count == 0U) {
+        return;
+    }
+
+    window_render_widgets(state, false);
 }
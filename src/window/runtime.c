@@ -5,6 +5,77 @@
 // Forward declaration for one shot watch timer callback
 static gboolean window_on_watch_poll(gpointer user_data);
 
+// Function pointers are replaceable so soak runs can drive a virtual clock
+static WindowClockFn g_window_clock_fn = g_get_monotonic_time;
+static WindowVolumeQueryFn g_window_volume_query_fn = osd_system_volume_query;
+static WindowTimeoutAddFn g_window_timeout_add_fn = g_timeout_add;
+static WindowSourceRemoveFn g_window_source_remove_fn = g_source_remove;
+
+void window_runtime_set_clock_fn(WindowClockFn clock_fn) {
+    // Null restores GLib monotonic clock
+    g_window_clock_fn = (clock_fn == NULL) ? g_get_monotonic_time : clock_fn;
+}
+
+void window_runtime_set_volume_query_fn(WindowVolumeQueryFn query_fn) {
+    // Null restores wpctl backed query
+    g_window_volume_query_fn = (query_fn == NULL) ? osd_system_volume_query : query_fn;
+}
+
+void window_runtime_set_timer_fns(WindowTimeoutAddFn timeout_add_fn, WindowSourceRemoveFn source_remove_fn) {
+    // Timer seams are swapped as a pair so ids never cross implementations
+    if (timeout_add_fn == NULL || source_remove_fn == NULL) {
+        g_window_timeout_add_fn = g_timeout_add;
+        g_window_source_remove_fn = g_source_remove;
+        return;
+    }
+
+    g_window_timeout_add_fn = timeout_add_fn;
+    g_window_source_remove_fn = source_remove_fn;
+}
+
+gint64 window_runtime_now_us(void) {
+    return g_window_clock_fn();
+}
+
+guint window_runtime_timeout_add(guint interval_ms, GSourceFunc callback, gpointer user_data) {
+    return g_window_timeout_add_fn(interval_ms, callback, user_data);
+}
+
+// Removes one timer source through the active seam and clears its id
+static void window_remove_timer(guint *source_id) {
+    if (*source_id != 0U) {
+        (void)g_window_source_remove_fn(*source_id);
+        *source_id = 0U;
+    }
+}
+
+void window_runtime_remove_timer(guint *source_id) {
+    if (source_id == NULL) {
+        return;
+    }
+
+    window_remove_timer(source_id);
+}
+
+void window_cancel_timers(WindowState *state) {
+    if (state == NULL) {
+        return;
+    }
+
+    window_remove_timer(&state->timeout_source_id);
+    window_remove_timer(&state->watch_source_id);
+}
+
+// Runs the volume query as the wpctl phase, the one that blocks the main loop the longest when PipeWire stalls
+static bool window_query_volume(WindowState *state, OSDVolumeState *out_state) {
+    bool ok = false;
+
+    window_watchdog_enter(state, WINDOW_PHASE_WPCTL);
+    ok = g_window_volume_query_fn(out_state, stderr);
+    window_watchdog_leave(state);
+    return ok;
+}
+
 // Compares sampled volume states to suppress redundant redraws
 static bool volume_states_equal(const OSDVolumeState *a, const OSDVolumeState *b) {
     return a->volume_percent == b->volume_percent && a->muted == b->muted;
@@ -32,6 +103,7 @@ static void window_log_watch_query_recovery(WindowState *state) {
 
     g_printerr("System volume query recovered; watch mode resumed\n");
     state->watch_query_failure_logged = false;
+    state->stats.query_recoveries++;
 }
 
 // Arms one shot watch polling using active or idle interval
@@ -41,23 +113,136 @@ static bool window_schedule_watch_poll(WindowState *state) {
     if (state == NULL) {
         return false;
     }
-    if (state->watch_source_id != 0U) {
-        // Remove any stale timer before re arming
-        g_source_remove(state->watch_source_id);
-        state->watch_source_id = 0U;
-    }
+    // Remove any stale timer before re arming
+    window_remove_timer(&state->watch_source_id);
 
     // Visible popup uses active interval hidden popup uses idle interval
     next_poll_ms = state->popup_visible ? state->args.watch_poll_ms : state->watch_idle_poll_ms;
-    state->watch_source_id = g_timeout_add(next_poll_ms, window_on_watch_poll, state);
+    state->watch_source_id = g_window_timeout_add_fn(next_poll_ms, window_on_watch_poll, state);
     if (state->watch_source_id == 0U) {
         window_set_error(state, "Failed to start watch timer");
         return false;
     }
+    state->stats.watch_timer_arms++;
+    state->stats.watch_poll_due_us = window_runtime_now_us() + (gint64)next_poll_ms * 1000;
 
     return true;
 }
 
+// Content opacity stands in for visibility while keep-mapped holds the surface
+// Zero opacity content produces no render nodes, so the hidden frame is fully transparent
+static void window_set_content_shown(WindowState *state, bool shown) {
+    for (unsigned int index = 0U; index < state->view_count; index++) {
+        WindowView *view = state->views[index];
+        GtkWidget *content = gtk_window_get_child(GTK_WINDOW(view->window));
+
+        if (content != NULL) {
+            gtk_widget_set_opacity(content, shown ? 1.0 : 0.0);
+        }
+        // Opacity changes repaint without a layout phase, so the opaque region is refreshed here
+        window_surface_update_regions(view);
+    }
+}
+
+// Maps or unmaps every view, presenting only the ones whose state changes
+// Views over a fullscreen client stay unmapped, since even transparent overlay surfaces block direct scanout
+static void window_set_views_mapped(WindowState *state, bool mapped) {
+    for (unsigned int index = 0U; index < state->view_count; index++) {
+        WindowView *view = state->views[index];
+        const bool visible = mapped && !view->suppressed;
+
+        if ((bool)gtk_widget_get_visible(view->window) == visible) {
+            continue;
+        }
+        gtk_widget_set_visible(view->window, visible);
+        if (visible) {
+            gtk_window_present(GTK_WINDOW(view->window));
+        }
+    }
+}
+
+// Maps the surfaces with transparent content so the next show is a single frame
+static void window_map_hidden(WindowState *state) {
+    window_set_content_shown(state, false);
+    window_set_views_mapped(state, true);
+}
+
+// Hides the popup the way hide_mode asks
+static void window_hide_popup(WindowState *state) {
+    if (state->sample_tick_id != 0U) {
+        // A sample queued for a frame that will never show is deferred like any other hidden update
+        gtk_widget_remove_tick_callback(state->sample_tick_widget, state->sample_tick_id);
+        state->sample_tick_id = 0U;
+        state->sample_tick_widget = NULL;
+        state->render_pending = true;
+    }
+    state->popup_visible = false;
+    state->stats.popup_hides++;
+    if (state->args.hide_mode == OSD_HIDE_MODE_KEEP_MAPPED) {
+        // Surface stays mapped and commits one transparent frame
+        window_set_content_shown(state, false);
+        return;
+    }
+    if (state->args.hide_mode == OSD_HIDE_MODE_RELEASE) {
+        // Idle memory wins over show latency, the next show rebuilds from args
+        window_release(state);
+        return;
+    }
+
+    window_set_views_mapped(state, false);
+}
+
+void window_runtime_apply_hide_mode(WindowState *state) {
+    if (state == NULL) {
+        return;
+    }
+
+    if (state->view_count == 0U) {
+        // Released popups rebuild lazily unless the new mode wants a mapped surface now
+        if (state->args.hide_mode == OSD_HIDE_MODE_KEEP_MAPPED && window_restore(state)) {
+            window_map_hidden(state);
+        }
+        return;
+    }
+
+    if (state->popup_visible) {
+        // A visible popup follows the new mode at its next hide
+        return;
+    }
+
+    if (state->args.hide_mode == OSD_HIDE_MODE_KEEP_MAPPED) {
+        window_map_hidden(state);
+        return;
+    }
+    if (state->args.hide_mode == OSD_HIDE_MODE_RELEASE) {
+        window_release(state);
+        return;
+    }
+
+    window_set_content_shown(state, true);
+    window_set_views_mapped(state, false);
+}
+
+void window_runtime_sync_views(WindowState *state) {
+    if (state == NULL || state->view_count == 0U) {
+        return;
+    }
+
+    // Fresh views have never rendered, so the next flush must reach them even if the volume is unchanged
+    state->render_pending = true;
+    (void)window_fullscreen_update_views(state);
+    if (state->popup_visible) {
+        // New views join a visible popup with current content instead of waiting for the next sample
+        window_flush_widgets(state);
+        window_set_content_shown(state, true);
+        window_set_views_mapped(state, true);
+        return;
+    }
+    if (state->args.hide_mode == OSD_HIDE_MODE_KEEP_MAPPED) {
+        window_map_hidden(state);
+    }
+}
+
 // Handles auto hide timeout for single and watch modes
 static gboolean window_on_timeout(gpointer user_data) {
     WindowState *state = user_data;
@@ -66,8 +251,7 @@ static gboolean window_on_timeout(gpointer user_data) {
     state->timeout_source_id = 0U;
     if (state->args.watch_mode) {
         // Watch mode hides popup and keeps polling
-        state->popup_visible = false;
-        gtk_widget_set_visible(state->window, FALSE);
+        window_hide_popup(state);
         return G_SOURCE_REMOVE;
     }
 
@@ -80,17 +264,15 @@ static gboolean window_on_timeout(gpointer user_data) {
 
 // Restarts popup hide timer after show or refresh
 static bool window_arm_timeout(WindowState *state) {
-    if (state->timeout_source_id != 0U) {
-        // Re arm avoids stale timeout callbacks
-        g_source_remove(state->timeout_source_id);
-        state->timeout_source_id = 0U;
-    }
+    // Re arm avoids stale timeout callbacks
+    window_remove_timer(&state->timeout_source_id);
 
-    state->timeout_source_id = g_timeout_add(state->args.timeout_ms, window_on_timeout, state);
+    state->timeout_source_id = g_window_timeout_add_fn(state->args.timeout_ms, window_on_timeout, state);
     if (state->timeout_source_id == 0U) {
         window_set_error(state, "Failed to start popup timeout timer");
         return false;
     }
+    state->stats.hide_timer_arms++;
 
     return true;
 }
@@ -98,17 +280,79 @@ static bool window_arm_timeout(WindowState *state) {
 // Shows popup and arms timeout handling
 static bool window_show_popup(WindowState *state) {
     if (!state->popup_visible) {
-        // Avoid repeated present calls while already visible
-        gtk_widget_set_visible(state->window, TRUE);
-        gtk_window_present(GTK_WINDOW(state->window));
+        if (window_fullscreen_blocks_show(state)) {
+            // Widgets keep deferring updates, so the next visible popup still shows the latest volume
+            state->stats.fullscreen_suppressions++;
+            return true;
+        }
+        // Latency runs until the first painted frame that carries the popup
+        state->stats.show_started_us = g_get_monotonic_time();
+        if (!window_restore(state)) {
+            window_set_error(state, "Failed to rebuild the popup window");
+            return false;
+        }
+        // Focus followed while hidden is applied once, before the surface is mapped or revealed
+        window_focus_apply(state);
+        (void)window_fullscreen_update_views(state);
+        // Updates deferred while hidden land before the first visible frame
+        window_flush_widgets(state);
+        window_set_content_shown(state, true);
+        // Unmapped surfaces go through map, configure, and a first frame
+        window_set_views_mapped(state, true);
         state->popup_visible = true;
+        state->stats.popup_shows++;
     }
     return window_arm_timeout(state);
 }
 
+// Applies the latest queued sample in the frame clock's update phase, right before layout and paint
+// Runs once and removes itself, so a popup whose volume stopped changing causes no frame wakeups
+static gboolean window_on_sample_tick(GtkWidget *widget, GdkFrameClock *clock, gpointer user_data) {
+    WindowState *state = user_data;
+
+    (void)widget;
+    (void)clock;
+    state->stats.sample_frames++;
+    window_update_widgets(state);
+    (void)window_arm_timeout(state);
+    return G_SOURCE_REMOVE;
+}
+
+// Clears the queued tick when it ran or when its window was destroyed with it
+static void window_on_sample_tick_removed(gpointer user_data) {
+    WindowState *state = user_data;
+
+    state->sample_tick_id = 0U;
+    state->sample_tick_widget = NULL;
+}
+
+// Defers a changed sample on a visible popup to the next frame of a view on screen
+// Every sample before that frame only overwrites current_volume, so a burst costs one render and one re-arm
+// Returns false when no view is mapped, and the caller applies the sample right away
+static bool window_queue_sample(WindowState *state) {
+    if (state->sample_tick_id != 0U) {
+        state->stats.samples_coalesced++;
+        return true;
+    }
+
+    for (unsigned int index = 0U; index < state->view_count; index++) {
+        GtkWidget *window = state->views[index]->window;
+
+        // Unmapped surfaces get no frames, so a tick queued on them would never run
+        if (!gtk_widget_get_mapped(window)) {
+            continue;
+        }
+        state->sample_tick_widget = window;
+        state->sample_tick_id =
+            gtk_widget_add_tick_callback(window, window_on_sample_tick, state, window_on_sample_tick_removed);
+        return true;
+    }
+    return false;
+}
+
 // Queries system volume and redraws widgets from fresh sample
 static bool window_refresh_from_system(WindowState *state) {
-    if (!osd_system_volume_query(&state->current_volume, stderr)) {
+    if (!window_query_volume(state, &state->current_volume)) {
         window_set_error(state, "Failed to query system volume from wpctl");
         return false;
     }
@@ -123,9 +367,20 @@ static gboolean window_on_watch_poll(gpointer user_data) {
     WindowState *state = user_data;
     OSDVolumeState sampled;
 
+    gint64 drift_us = 0;
+
     // One shot timer model clears id then re schedules
     state->watch_source_id = 0U;
-    if (!osd_system_volume_query(&sampled, stderr)) {
+    state->stats.watch_polls++;
+    // Lateness against the armed due time exposes timer drift over long uptimes
+    drift_us = window_runtime_now_us() - state->stats.watch_poll_due_us;
+    if (drift_us > state->stats.max_poll_drift_us) {
+        state->stats.max_poll_drift_us = drift_us;
+    }
+    // The poll timer doubles as the dispatch latency canary for blocking nobody tagged
+    window_watchdog_note_poll_latency(state, drift_us);
+    if (!window_query_volume(state, &sampled)) {
+        state->stats.query_failures++;
         window_log_watch_query_failure(
             state,
             "Failed to query system volume while watching; keeping watcher alive and retrying"
@@ -151,9 +406,12 @@ static gboolean window_on_watch_poll(gpointer user_data) {
     if (!volume_states_equal(&sampled, &state->current_volume)) {
         // Changed values trigger redraw and popup refresh
         state->current_volume = sampled;
-        window_update_widgets(state);
-        if (!window_show_popup(state)) {
-            return G_SOURCE_REMOVE;
+        // Shows stay immediate, only samples landing on an already visible popup wait for its next frame
+        if (!state->popup_visible || !window_queue_sample(state)) {
+            window_update_widgets(state);
+            if (!window_show_popup(state)) {
+                return G_SOURCE_REMOVE;
+            }
         }
     }
 
@@ -169,7 +427,7 @@ bool window_activate_watch_mode(WindowState *state, GtkApplication *app) {
     OSDVolumeState sampled;
 
     // Initial query may fail during startup races retry loop handles recovery
-    if (osd_system_volume_query(&sampled, stderr)) {
+    if (window_query_volume(state, &sampled)) {
         state->current_volume = sampled;
         state->has_previous_watch_sample = true;
         window_log_watch_query_recovery(state);
@@ -179,6 +437,7 @@ bool window_activate_watch_mode(WindowState *state, GtkApplication *app) {
             return false;
         }
     } else {
+        state->stats.query_failures++;
         window_log_watch_query_failure(
             state,
             "Initial system volume query failed; watch mode will retry in background"
@@ -186,10 +445,37 @@ bool window_activate_watch_mode(WindowState *state, GtkApplication *app) {
         state->has_previous_watch_sample = false;
     }
 
+    if (state->args.hide_mode == OSD_HIDE_MODE_KEEP_MAPPED && !state->popup_visible) {
+        // Without a first sample nothing was shown, so the surface is mapped up front
+        window_map_hidden(state);
+    } else if (state->args.hide_mode == OSD_HIDE_MODE_RELEASE && !state->popup_visible) {
+        // Same case for release, which idles without a window from the start
+        window_release(state);
+    }
+
     g_application_hold(G_APPLICATION(app));
     // Hold prevents GTK exit while popup is hidden in watch mode
     state->app_held = true;
 
+    if (!window_stats_install_signal(state)) {
+        // Stats dump is diagnostic only and never blocks watch startup
+        g_printerr("Failed to install SIGUSR1 stats handler; continuing without it\n");
+    }
+
+    if (!window_config_reload_install(state)) {
+        // Hot reload is a convenience and never blocks watch startup
+        g_printerr("Failed to watch config file for changes; continuing without hot reload\n");
+    }
+
+    if (!window_css_reload_install(state)) {
+        g_printerr("Failed to watch custom CSS file for changes; continuing without CSS hot reload\n");
+    }
+
+    if (!window_watchdog_start(state)) {
+        // Stalls are still counted and logged once they end, just not while they last
+        g_printerr("Failed to start main loop watchdog thread; continuing without live stall reports\n");
+    }
+
     if (!window_schedule_watch_poll(state)) {
         return false;
     }
@@ -197,6 +483,24 @@ bool window_activate_watch_mode(WindowState *state, GtkApplication *app) {
     return true;
 }
 
+// Applies new timeout and poll intervals to timers that are already pending
+bool window_runtime_retime(WindowState *state) {
+    if (state == NULL) {
+        return false;
+    }
+
+    if (state->timeout_source_id != 0U && !window_arm_timeout(state)) {
+        return false;
+    }
+
+    // Watch timer is re armed only while the loop is running
+    if (state->watch_source_id != 0U && !window_schedule_watch_poll(state)) {
+        return false;
+    }
+
+    return true;
+}
+
 // Runs single popup mode from system or explicit argument values
 bool window_activate_single_popup(WindowState *state) {
     if (state->args.use_system_volume) {
@@ -0,0 +1,257 @@
+#include "internal.h"
+
+#include "common/safeio.h"
+
+#include <glib-unix.h>
+#include <signal.h>
+
+// Writes one key=value pair with a leading space separator
+static void window_stats_write_pair(FILE *out_stream, const char *key, long long value) {
+    (void)osd_io_write_text(out_stream, " ");
+    (void)osd_io_write_text(out_stream, key);
+    (void)osd_io_write_text(out_stream, "=");
+    (void)osd_io_write_long_long(out_stream, value);
+}
+
+// Writes one unsigned counter pair
+static void window_stats_write_counter(FILE *out_stream, const char *key, guint64 value) {
+    (void)osd_io_write_text(out_stream, " ");
+    (void)osd_io_write_text(out_stream, key);
+    (void)osd_io_write_text(out_stream, "=");
+    (void)osd_io_write_unsigned_long_long(out_stream, (unsigned long long)value);
+}
+
+// Growth is only meaningful when both samples were readable
+static long long window_stats_delta(long long baseline, long long current) {
+    if (baseline < 0LL || current < 0LL) {
+        return 0LL;
+    }
+
+    return current - baseline;
+}
+
+void window_stats_init(WindowState *state) {
+    g_return_if_fail(state != NULL);
+
+    state->stats.started_us = window_runtime_now_us();
+    (void)osd_system_resource_sample(&state->stats.baseline_resources);
+}
+
+void window_stats_write(const WindowState *state, FILE *out_stream) {
+    const WindowRuntimeStats *stats = NULL;
+    OSDResourceUsage current;
+
+    if (state == NULL || out_stream == NULL) {
+        return;
+    }
+
+    stats = &state->stats;
+    (void)osd_system_resource_sample(&current);
+
+    // Single line keeps output greppable across long soak logs
+    (void)osd_io_write_text(out_stream, "hyprvolume stats:");
+    window_stats_write_pair(out_stream, "uptime_ms", (long long)((window_runtime_now_us() - stats->started_us) / 1000));
+    window_stats_write_counter(out_stream, "watch_polls", stats->watch_polls);
+    window_stats_write_counter(out_stream, "watch_timer_arms", stats->watch_timer_arms);
+    window_stats_write_counter(out_stream, "hide_timer_arms", stats->hide_timer_arms);
+    window_stats_write_counter(out_stream, "popup_windows", state->view_count);
+    window_stats_write_counter(out_stream, "monitor_changes", stats->monitor_changes);
+    window_stats_write_counter(out_stream, "placement_updates", stats->placement_updates);
+    window_stats_write_counter(out_stream, "focus_events", stats->focus_events);
+    window_stats_write_counter(out_stream, "fullscreen_suppressions", stats->fullscreen_suppressions);
+    window_stats_write_counter(out_stream, "popup_shows", stats->popup_shows);
+    window_stats_write_counter(out_stream, "popup_hides", stats->popup_hides);
+    window_stats_write_counter(out_stream, "sample_frames", stats->sample_frames);
+    window_stats_write_counter(out_stream, "samples_coalesced", stats->samples_coalesced);
+    window_stats_write_counter(out_stream, "query_failures", stats->query_failures);
+    window_stats_write_counter(out_stream, "query_recoveries", stats->query_recoveries);
+    window_stats_write_pair(out_stream, "max_poll_drift_us", (long long)stats->max_poll_drift_us);
+    window_stats_write_counter(out_stream, "layout_passes", stats->layout_passes);
+    window_stats_write_counter(out_stream, "window_resizes", stats->window_resizes);
+    window_stats_write_counter(out_stream, "frames_painted", stats->frames_painted);
+    window_stats_write_pair(
+        out_stream,
+        "frame_avg_us",
+        (stats->frames_painted > 0U) ? (long long)(stats->frame_paint_total_us / (gint64)stats->frames_painted) : 0LL
+    );
+    window_stats_write_pair(out_stream, "frame_max_us", (long long)stats->frame_paint_max_us);
+    window_stats_write_counter(out_stream, "animation_frames", stats->animation_frames);
+    window_stats_write_counter(out_stream, "animation_retargets", stats->animation_retargets);
+    window_stats_write_counter(out_stream, "animation_missed_frames", stats->animation_missed_frames);
+    window_stats_write_counter(out_stream, "animation_over_budget", stats->animation_over_budget);
+    window_stats_write_pair(out_stream, "animation_budget_us", (long long)stats->animation_budget_us);
+    for (unsigned int phase = WINDOW_PHASE_WPCTL; phase < WINDOW_PHASE_COUNT; phase++) {
+        char key[32];
+
+        (void)g_snprintf(key, sizeof(key), "stalls_%s", window_phase_name((WindowPhase)phase));
+        window_stats_write_counter(out_stream, key, stats->stalls[phase]);
+    }
+    window_stats_write_pair(out_stream, "stall_max_us", (long long)stats->stall_max_us);
+    window_stats_write_counter(out_stream, "shows_painted", stats->shows_painted);
+    window_stats_write_pair(
+        out_stream,
+        "show_latency_avg_us",
+        (stats->shows_painted > 0U) ? (long long)(stats->show_latency_total_us / (gint64)stats->shows_painted) : 0LL
+    );
+    window_stats_write_pair(out_stream, "show_latency_max_us", (long long)stats->show_latency_max_us);
+    window_stats_write_counter(out_stream, "window_releases", stats->window_releases);
+    window_stats_write_pair(out_stream, "release_rss_before_kib", stats->release_rss_before_kib);
+    window_stats_write_pair(out_stream, "release_rss_after_kib", stats->release_rss_after_kib);
+    window_stats_write_counter(out_stream, "window_restores", stats->window_restores);
+    window_stats_write_pair(
+        out_stream,
+        "restore_avg_us",
+        (stats->window_restores > 0U) ? (long long)(stats->restore_total_us / (gint64)stats->window_restores) : 0LL
+    );
+    window_stats_write_pair(out_stream, "restore_max_us", (long long)stats->restore_max_us);
+    window_stats_write_pair(out_stream, "rss_kib", current.rss_kib);
+    window_stats_write_pair(
+        out_stream,
+        "rss_growth_kib",
+        window_stats_delta(stats->baseline_resources.rss_kib, current.rss_kib)
+    );
+    window_stats_write_pair(out_stream, "open_fds", current.open_fds);
+    window_stats_write_pair(
+        out_stream,
+        "fd_growth",
+        window_stats_delta(stats->baseline_resources.open_fds, current.open_fds)
+    );
+    window_stats_write_pair(out_stream, "zombie_children", current.zombie_children);
+    (void)osd_io_write_line(out_stream, "");
+    (void)fflush(out_stream);
+}
+
+// SIGUSR1 dispatch runs on the GTK main loop so counters are read consistently
+static gboolean window_on_stats_signal(gpointer user_data) {
+    WindowState *state = user_data;
+
+    window_stats_write(state, stderr);
+    return G_SOURCE_CONTINUE;
+}
+
+bool window_stats_install_signal(WindowState *state) {
+    g_return_val_if_fail(state != NULL, false);
+
+    if (state->stats_signal_source_id != 0U) {
+        return true;
+    }
+
+    state->stats_signal_source_id = g_unix_signal_add(SIGUSR1, window_on_stats_signal, state);
+    return state->stats_signal_source_id != 0U;
+}
+
+// Frame clock phases always emit before-paint and after-paint, paint only when something was drawn
+static void window_stats_on_before_paint(GdkFrameClock *clock, gpointer user_data) {
+    WindowState *state = user_data;
+
+    (void)clock;
+    // Render cost is real time even when the runtime clock seam is replaced
+    state->stats.frame_started_us = g_get_monotonic_time();
+    state->stats.frame_painting = false;
+    state->stats.frame_animating = false;
+}
+
+// Emitted only when a resize or restyle requested the phase, so a value change that just redraws never counts
+static void window_stats_on_layout(GdkFrameClock *clock, gpointer user_data) {
+    WindowState *state = user_data;
+
+    (void)clock;
+    state->stats.layout_passes++;
+}
+
+static void window_stats_on_paint(GdkFrameClock *clock, gpointer user_data) {
+    WindowState *state = user_data;
+
+    (void)clock;
+    state->stats.frame_painting = true;
+}
+
+// A size change on a shown window means a new layer surface size and a compositor configure round trip
+static void window_stats_note_window_sizes(WindowState *state) {
+    for (unsigned int index = 0U; index < state->view_count; index++) {
+        WindowView *view = state->views[index];
+        int width = 0;
+        int height = 0;
+
+        if (view == NULL || view->window == NULL || !gtk_widget_get_mapped(view->window)) {
+            continue;
+        }
+        width = gtk_widget_get_width(view->window);
+        height = gtk_widget_get_height(view->window);
+        if (width <= 0 || height <= 0 || (width == view->painted_width && height == view->painted_height)) {
+            continue;
+        }
+        if (view->painted_width > 0 && view->painted_height > 0) {
+            state->stats.window_resizes++;
+        }
+        view->painted_width = width;
+        view->painted_height = height;
+    }
+}
+
+static void window_stats_on_after_paint(GdkFrameClock *clock, gpointer user_data) {
+    WindowState *state = user_data;
+    gint64 now_us = 0;
+    gint64 elapsed_us = 0;
+
+    (void)clock;
+    if (!state->stats.frame_painting) {
+        return;
+    }
+
+    now_us = g_get_monotonic_time();
+    elapsed_us = now_us - state->stats.frame_started_us;
+    state->stats.frame_painting = false;
+    state->stats.frames_painted++;
+    window_stats_note_window_sizes(state);
+    state->stats.frame_paint_total_us += elapsed_us;
+    if (elapsed_us > state->stats.frame_paint_max_us) {
+        state->stats.frame_paint_max_us = elapsed_us;
+    }
+    if (state->stats.frame_animating && elapsed_us > state->stats.animation_budget_us) {
+        // Tick, layout, and paint together took longer than one refresh, so the compositor saw a late frame
+        state->stats.animation_over_budget++;
+    }
+
+    if (state->stats.show_started_us != 0) {
+        // First painted frame after a show request, including any map and configure round trip
+        elapsed_us = now_us - state->stats.show_started_us;
+        state->stats.show_started_us = 0;
+        state->stats.shows_painted++;
+        state->stats.show_latency_total_us += elapsed_us;
+        if (elapsed_us > state->stats.show_latency_max_us) {
+            state->stats.show_latency_max_us = elapsed_us;
+        }
+    }
+}
+
+// Frame clocks belong to surfaces, so hooks follow the window realization
+static void window_stats_on_realize(GtkWidget *widget, gpointer user_data) {
+    GdkFrameClock *clock = gtk_widget_get_frame_clock(widget);
+
+    if (clock == NULL) {
+        return;
+    }
+
+    g_signal_connect(clock, "before-paint", G_CALLBACK(window_stats_on_before_paint), user_data);
+    g_signal_connect(clock, "layout", G_CALLBACK(window_stats_on_layout), user_data);
+    g_signal_connect(clock, "paint", G_CALLBACK(window_stats_on_paint), user_data);
+    g_signal_connect(clock, "after-paint", G_CALLBACK(window_stats_on_after_paint), user_data);
+}
+
+static void window_stats_on_unrealize(GtkWidget *widget, gpointer user_data) {
+    GdkFrameClock *clock = gtk_widget_get_frame_clock(widget);
+
+    if (clock != NULL) {
+        g_signal_handlers_disconnect_by_data(clock, user_data);
+    }
+}
+
+void window_stats_track_frames(WindowState *state, WindowView *view) {
+    g_return_if_fail(state != NULL);
+    g_return_if_fail(view != NULL && view->window != NULL);
+
+    // Views paint from separate frame clocks whose phases never interleave, so one set of counters serves all
+    g_signal_connect(view->window, "realize", G_CALLBACK(window_stats_on_realize), state);
+    g_signal_connect(view->window, "unrealize", G_CALLBACK(window_stats_on_unrealize), state);
+}
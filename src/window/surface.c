@@ -0,0 +1,104 @@
+#include "internal.h"
+
+#include "window/card.h"
+
+#include <math.h>
+
+// Region for the opaque band of a prerendered card in surface coordinates, NULL when nothing is opaque
+// Edges round inward so no translucent pixel is ever claimed
+static cairo_region_t *window_surface_opaque_region(WindowView *view) {
+    GtkWidget *content = gtk_window_get_child(GTK_WINDOW(view->window));
+    graphene_rect_t opaque_rect;
+    graphene_rect_t card_bounds;
+    double surface_x = 0.0;
+    double surface_y = 0.0;
+    cairo_rectangle_int_t rect;
+    double left = 0.0;
+    double top = 0.0;
+    double right = 0.0;
+    double bottom = 0.0;
+
+    // CSS drawn cards can be restyled into anything, so only the prerendered card reports opacity
+    if (content == NULL || !WINDOW_IS_CARD(content) ||
+        !window_card_get_opaque_rect(WINDOW_CARD(content), &opaque_rect) ||
+        !gtk_widget_compute_bounds(content, view->window, &card_bounds)) {
+        return NULL;
+    }
+
+    gtk_native_get_surface_transform(GTK_NATIVE(view->window), &surface_x, &surface_y);
+    surface_x += (double)card_bounds.origin.x + (double)opaque_rect.origin.x;
+    surface_y += (double)card_bounds.origin.y + (double)opaque_rect.origin.y;
+    left = ceil(surface_x);
+    top = ceil(surface_y);
+    right = floor(surface_x + (double)opaque_rect.size.width);
+    bottom = floor(surface_y + (double)opaque_rect.size.height);
+    if (right <= left || bottom <= top) {
+        return NULL;
+    }
+
+    rect.x = (int)left;
+    rect.y = (int)top;
+    rect.width = (int)(right - left);
+    rect.height = (int)(bottom - top);
+    return cairo_region_create_rectangle(&rect);
+}
+
+void window_surface_update_regions(WindowView *view) {
+    GdkSurface *surface = NULL;
+    cairo_region_t *region = NULL;
+
+    if (view == NULL || view->window == NULL) {
+        return;
+    }
+    surface = gtk_native_get_surface(GTK_NATIVE(view->window));
+    if (surface == NULL) {
+        return;
+    }
+
+    // The popup never takes pointer input, so clicks always reach whatever is underneath
+    region = cairo_region_create();
+    gdk_surface_set_input_region(surface, region);
+    cairo_region_destroy(region);
+
+    // Lets the compositor skip blending and drawing what the card fully covers
+    // GDK ignores repeats of the current regions, so calling this every layout is cheap
+    region = window_surface_opaque_region(view);
+    G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+    gdk_surface_set_opaque_region(surface, region);
+    G_GNUC_END_IGNORE_DEPRECATIONS
+    if (region != NULL) {
+        cairo_region_destroy(region);
+    }
+}
+
+// GtkWindow rewrites the opaque region from its own background during allocation and style changes
+// This handler is connected after GTK's, so it reapplies ours at the end of every layout phase
+static void window_surface_on_layout(GdkFrameClock *clock, gpointer user_data) {
+    (void)clock;
+    window_surface_update_regions(user_data);
+}
+
+// Frame clocks belong to surfaces, so hooks follow the window realization
+static void window_surface_on_realize(GtkWidget *widget, gpointer user_data) {
+    GdkFrameClock *clock = gtk_widget_get_frame_clock(widget);
+
+    if (clock != NULL) {
+        g_signal_connect(clock, "layout", G_CALLBACK(window_surface_on_layout), user_data);
+    }
+    window_surface_update_regions(user_data);
+}
+
+static void window_surface_on_unrealize(GtkWidget *widget, gpointer user_data) {
+    GdkFrameClock *clock = gtk_widget_get_frame_clock(widget);
+
+    if (clock != NULL) {
+        g_signal_handlers_disconnect_by_func(clock, G_CALLBACK(window_surface_on_layout), user_data);
+    }
+}
+
+void window_surface_track_regions(WindowView *view) {
+    g_return_if_fail(view != NULL && view->window != NULL);
+
+    g_signal_connect(view->window, "realize", G_CALLBACK(window_surface_on_realize), view);
+    g_signal_connect(view->window, "unrealize", G_CALLBACK(window_surface_on_unrealize), view);
+}
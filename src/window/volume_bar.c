@@ -0,0 +1,184 @@
+#include "window/volume_bar.h"
+
+#include "style/style.h"
+
+#include <math.h>
+
+// Track outline from the base theme, drawn as a 1px rounded border
+#define WINDOW_VOLUME_BAR_BORDER_PX 1.0F
+
+struct _WindowVolumeBar {
+    GtkWidget parent_instance;
+    GtkOrientation orientation;
+    double fraction;
+    OSDStylePaint track_paint;
+    OSDStylePaint fill_paint;
+    GdkRGBA border_color;
+    // Track and border node reused while the size holds, so value changes diff only the fill
+    GskRenderNode *track_node;
+    float track_width;
+    float track_height;
+};
+
+G_DEFINE_FINAL_TYPE(WindowVolumeBar, window_volume_bar, GTK_TYPE_WIDGET)
+
+// Clips paint to a pill shaped rect, matching the 999px radius of the CSS theme
+static void window_volume_bar_append_pill(
+    GtkSnapshot *snapshot,
+    const OSDStylePaint *paint,
+    const graphene_rect_t *bounds,
+    GskRoundedRect *out_shape
+) {
+    gsk_rounded_rect_init_from_rect(out_shape, bounds, fminf(bounds->size.width, bounds->size.height) / 2.0F);
+    gtk_snapshot_push_rounded_clip(snapshot, out_shape);
+    osd_style_append_paint(snapshot, paint, bounds);
+    gtk_snapshot_pop(snapshot);
+}
+
+// Static part of the bar, the pill track and its outline
+static GskRenderNode *window_volume_bar_build_track(WindowVolumeBar *self, float width, float height) {
+    const float border_widths[4] = {
+        WINDOW_VOLUME_BAR_BORDER_PX,
+        WINDOW_VOLUME_BAR_BORDER_PX,
+        WINDOW_VOLUME_BAR_BORDER_PX,
+        WINDOW_VOLUME_BAR_BORDER_PX
+    };
+    const GdkRGBA border_colors[4] = {self->border_color, self->border_color, self->border_color, self->border_color};
+    GtkSnapshot *snapshot = gtk_snapshot_new();
+    graphene_rect_t track_rect;
+    GskRoundedRect track_shape;
+
+    graphene_rect_init(&track_rect, 0.0F, 0.0F, width, height);
+    window_volume_bar_append_pill(snapshot, &self->track_paint, &track_rect, &track_shape);
+    gtk_snapshot_append_border(snapshot, &track_shape, border_widths, border_colors);
+    return gtk_snapshot_free_to_node(snapshot);
+}
+
+static void window_volume_bar_snapshot(GtkWidget *widget, GtkSnapshot *snapshot) {
+    WindowVolumeBar *self = WINDOW_VOLUME_BAR(widget);
+    const float width = (float)gtk_widget_get_width(widget);
+    const float height = (float)gtk_widget_get_height(widget);
+    graphene_rect_t fill_rect;
+    GskRoundedRect fill_shape;
+    float inner_width = 0.0F;
+    float inner_height = 0.0F;
+    float fill_extent = 0.0F;
+
+    if (width <= 0.0F || height <= 0.0F) {
+        return;
+    }
+
+    // An identical node pointer diffs as unchanged, so damage covers only the old and new fill
+    if (self->track_node == NULL || self->track_width != width || self->track_height != height) {
+        g_clear_pointer(&self->track_node, gsk_render_node_unref);
+        self->track_node = window_volume_bar_build_track(self, width, height);
+        self->track_width = width;
+        self->track_height = height;
+    }
+    if (self->track_node != NULL) {
+        gtk_snapshot_append_node(snapshot, self->track_node);
+    }
+
+    // Fill sits inside the track border like the progress node sat inside the trough
+    inner_width = width - 2.0F * WINDOW_VOLUME_BAR_BORDER_PX;
+    inner_height = height - 2.0F * WINDOW_VOLUME_BAR_BORDER_PX;
+    if (inner_width <= 0.0F || inner_height <= 0.0F || self->fraction <= 0.0) {
+        return;
+    }
+
+    if (self->orientation == GTK_ORIENTATION_VERTICAL) {
+        // Grows from the top like a non-inverted vertical GtkProgressBar
+        fill_extent = inner_height * (float)self->fraction;
+        graphene_rect_init(
+            &fill_rect,
+            WINDOW_VOLUME_BAR_BORDER_PX,
+            WINDOW_VOLUME_BAR_BORDER_PX,
+            inner_width,
+            fill_extent
+        );
+    } else {
+        fill_extent = inner_width * (float)self->fraction;
+        graphene_rect_init(
+            &fill_rect,
+            (gtk_widget_get_direction(widget) == GTK_TEXT_DIR_RTL)
+                ? width - WINDOW_VOLUME_BAR_BORDER_PX - fill_extent
+                : WINDOW_VOLUME_BAR_BORDER_PX,
+            WINDOW_VOLUME_BAR_BORDER_PX,
+            fill_extent,
+            inner_height
+        );
+    }
+    window_volume_bar_append_pill(snapshot, &self->fill_paint, &fill_rect, &fill_shape);
+}
+
+static void window_volume_bar_dispose(GObject *object) {
+    g_clear_pointer(&WINDOW_VOLUME_BAR(object)->track_node, gsk_render_node_unref);
+    G_OBJECT_CLASS(window_volume_bar_parent_class)->dispose(object);
+}
+
+static void window_volume_bar_class_init(WindowVolumeBarClass *klass) {
+    GObjectClass *object_class = G_OBJECT_CLASS(klass);
+    GtkWidgetClass *widget_class = GTK_WIDGET_CLASS(klass);
+
+    object_class->dispose = window_volume_bar_dispose;
+    widget_class->snapshot = window_volume_bar_snapshot;
+    // Single CSS node, sized by .osd-bar min-width and min-height rules
+    gtk_widget_class_set_css_name(widget_class, "volumebar");
+    gtk_widget_class_set_accessible_role(widget_class, GTK_ACCESSIBLE_ROLE_PROGRESS_BAR);
+}
+
+static void window_volume_bar_init(WindowVolumeBar *self) {
+    OSDStylePaint border_paint;
+
+    self->orientation = GTK_ORIENTATION_HORIZONTAL;
+    self->fraction = 0.0;
+    // Same fixed theme value the base sheet reads for the trough border, parsed once per bar
+    self->border_color = (GdkRGBA){0.0F, 0.0F, 0.0F, 0.0F};
+    if (osd_style_parse_paint(OSD_STYLE_THEME_TRACK_BORDER_COLOR, &border_paint) && border_paint.stop_count == 1U) {
+        self->border_color = border_paint.stops[0].color;
+    }
+    self->track_node = NULL;
+    self->track_width = 0.0F;
+    self->track_height = 0.0F;
+}
+
+GtkWidget *window_volume_bar_new(
+    GtkOrientation orientation,
+    const OSDStylePaint *track_paint,
+    const OSDStylePaint *fill_paint
+) {
+    WindowVolumeBar *self = NULL;
+
+    g_return_val_if_fail(track_paint != NULL, NULL);
+    g_return_val_if_fail(fill_paint != NULL, NULL);
+
+    self = g_object_new(WINDOW_TYPE_VOLUME_BAR, NULL);
+    self->orientation = orientation;
+    self->track_paint = *track_paint;
+    self->fill_paint = *fill_paint;
+    gtk_accessible_update_property(
+        GTK_ACCESSIBLE(self),
+        GTK_ACCESSIBLE_PROPERTY_VALUE_MIN,
+        0.0,
+        GTK_ACCESSIBLE_PROPERTY_VALUE_MAX,
+        1.0,
+        GTK_ACCESSIBLE_PROPERTY_VALUE_NOW,
+        0.0,
+        -1
+    );
+    return GTK_WIDGET(self);
+}
+
+void window_volume_bar_set_fraction(WindowVolumeBar *self, double fraction) {
+    g_return_if_fail(WINDOW_IS_VOLUME_BAR(self));
+
+    fraction = CLAMP(fraction, 0.0, 1.0);
+    if (self->fraction == fraction) {
+        return;
+    }
+
+    self->fraction = fraction;
+    gtk_accessible_update_property(GTK_ACCESSIBLE(self), GTK_ACCESSIBLE_PROPERTY_VALUE_NOW, fraction, -1);
+    // Size never depends on the fraction, so only this widget's render node is rebuilt
+    gtk_widget_queue_draw(GTK_WIDGET(self));
+}
@@ -0,0 +1,21 @@
+#ifndef WINDOW_VOLUME_BAR_H
+#define WINDOW_VOLUME_BAR_H
+
+#include "style/style.h"
+
+#include <gtk/gtk.h>
+
+// Rounded track plus fill drawn straight into the snapshot, with no trough or progress CSS nodes
+#define WINDOW_TYPE_VOLUME_BAR (window_volume_bar_get_type())
+G_DECLARE_FINAL_TYPE(WindowVolumeBar, window_volume_bar, WINDOW, VOLUME_BAR, GtkWidget)
+
+// Creates a bar painting track and fill from decoded theme values
+GtkWidget *window_volume_bar_new(
+    GtkOrientation orientation,
+    const OSDStylePaint *track_paint,
+    const OSDStylePaint *fill_paint
+);
+// Stores a fraction clamped to [0, 1] and queues a redraw of this widget only
+void window_volume_bar_set_fraction(WindowVolumeBar *self, double fraction);
+
+#endif
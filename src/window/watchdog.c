@@ -0,0 +1,190 @@
+#include "internal.h"
+
+// Longer than any frame a user would forgive, shorter than a wpctl hang at OSD_WPCTL_IO_TIMEOUT_MS
+#define WINDOW_WATCHDOG_STALL_US 200000
+
+static const char *const g_window_phase_names[WINDOW_PHASE_COUNT] = {
+    "idle",
+    "wpctl",
+    "config",
+    "css",
+    "render",
+    "other",
+};
+
+const char *window_phase_name(WindowPhase phase) {
+    if ((unsigned int)phase >= (unsigned int)WINDOW_PHASE_COUNT) {
+        return "unknown";
+    }
+    return g_window_phase_names[phase];
+}
+
+// Shared fields need the lock only once the thread exists, before that the main loop is the only reader
+static void window_watchdog_lock(WindowWatchdog *watchdog) {
+    if (watchdog->thread != NULL) {
+        g_mutex_lock(&watchdog->lock);
+    }
+}
+
+static void window_watchdog_unlock(WindowWatchdog *watchdog) {
+    if (watchdog->thread != NULL) {
+        g_mutex_unlock(&watchdog->lock);
+    }
+}
+
+// Sleeps until a phase starts, then until it crosses the threshold, so an idle watcher costs no wakeups
+// Reports from here land while the main loop is still blocked, which is the point of a separate thread
+static gpointer window_watchdog_run(gpointer user_data) {
+    WindowWatchdog *watchdog = user_data;
+
+    g_mutex_lock(&watchdog->lock);
+    while (!watchdog->stopping) {
+        const char *phase_name = NULL;
+        gint64 deadline_us = 0;
+
+        if (watchdog->phase == WINDOW_PHASE_IDLE || watchdog->reported_serial == watchdog->phase_serial) {
+            g_cond_wait(&watchdog->cond, &watchdog->lock);
+            continue;
+        }
+        deadline_us = watchdog->phase_started_us + WINDOW_WATCHDOG_STALL_US;
+        if (g_get_monotonic_time() < deadline_us) {
+            // Leave and enter both signal, so an ended phase wakes this into the idle wait instead of the deadline
+            (void)g_cond_wait_until(&watchdog->cond, &watchdog->lock, deadline_us);
+            continue;
+        }
+
+        watchdog->reported_serial = watchdog->phase_serial;
+        phase_name = window_phase_name(watchdog->phase);
+        g_mutex_unlock(&watchdog->lock);
+        g_printerr(
+            "Main loop blocked for over %d ms in %s; the popup is frozen until it returns\n",
+            WINDOW_WATCHDOG_STALL_US / 1000,
+            phase_name
+        );
+        g_mutex_lock(&watchdog->lock);
+    }
+    g_mutex_unlock(&watchdog->lock);
+    return NULL;
+}
+
+bool window_watchdog_start(WindowState *state) {
+    WindowWatchdog *watchdog = NULL;
+
+    g_return_val_if_fail(state != NULL, false);
+
+    watchdog = &state->watchdog;
+    if (watchdog->thread != NULL) {
+        return true;
+    }
+
+    g_mutex_init(&watchdog->lock);
+    g_cond_init(&watchdog->cond);
+    watchdog->stopping = false;
+    watchdog->reported_serial = watchdog->phase_serial;
+    watchdog->thread = g_thread_try_new("hyprvolume-watchdog", window_watchdog_run, watchdog, NULL);
+    if (watchdog->thread == NULL) {
+        g_cond_clear(&watchdog->cond);
+        g_mutex_clear(&watchdog->lock);
+        return false;
+    }
+    return true;
+}
+
+void window_watchdog_stop(WindowState *state) {
+    WindowWatchdog *watchdog = NULL;
+
+    if (state == NULL || state->watchdog.thread == NULL) {
+        return;
+    }
+
+    watchdog = &state->watchdog;
+    g_mutex_lock(&watchdog->lock);
+    watchdog->stopping = true;
+    g_cond_signal(&watchdog->cond);
+    g_mutex_unlock(&watchdog->lock);
+    g_thread_join(watchdog->thread);
+    watchdog->thread = NULL;
+    g_cond_clear(&watchdog->cond);
+    g_mutex_clear(&watchdog->lock);
+}
+
+// Counts one stall against the phase it happened in
+static void window_watchdog_record(WindowState *state, WindowPhase phase, gint64 elapsed_us) {
+    state->stats.stalls[phase]++;
+    if (elapsed_us > state->stats.stall_max_us) {
+        state->stats.stall_max_us = elapsed_us;
+    }
+}
+
+void window_watchdog_enter(WindowState *state, WindowPhase phase) {
+    WindowWatchdog *watchdog = &state->watchdog;
+
+    watchdog->depth++;
+    if (watchdog->depth > 1U) {
+        // A render inside a config reload is part of that reload's cost
+        return;
+    }
+
+    window_watchdog_lock(watchdog);
+    watchdog->phase = phase;
+    watchdog->phase_started_us = g_get_monotonic_time();
+    watchdog->phase_serial++;
+    if (watchdog->thread != NULL) {
+        g_cond_signal(&watchdog->cond);
+    }
+    window_watchdog_unlock(watchdog);
+}
+
+void window_watchdog_leave(WindowState *state) {
+    WindowWatchdog *watchdog = &state->watchdog;
+    const gint64 now_us = g_get_monotonic_time();
+    WindowPhase phase = WINDOW_PHASE_IDLE;
+    gint64 elapsed_us = 0;
+    bool reported = false;
+
+    if (watchdog->depth == 0U) {
+        return;
+    }
+    watchdog->depth--;
+    if (watchdog->depth > 0U) {
+        return;
+    }
+
+    window_watchdog_lock(watchdog);
+    phase = watchdog->phase;
+    elapsed_us = now_us - watchdog->phase_started_us;
+    reported = watchdog->reported_serial == watchdog->phase_serial;
+    watchdog->phase = WINDOW_PHASE_IDLE;
+    if (watchdog->thread != NULL) {
+        g_cond_signal(&watchdog->cond);
+    }
+    window_watchdog_unlock(watchdog);
+
+    if (elapsed_us < WINDOW_WATCHDOG_STALL_US) {
+        return;
+    }
+    window_watchdog_record(state, phase, elapsed_us);
+    watchdog->last_stall_end_us = now_us;
+    if (reported) {
+        g_printerr("Main loop resumed after %lld ms in %s\n", (long long)(elapsed_us / 1000), window_phase_name(phase));
+        return;
+    }
+    // Without the thread, as in one-shot mode, the stall is only known once it is over
+    g_printerr("Main loop was blocked for %lld ms in %s\n", (long long)(elapsed_us / 1000), window_phase_name(phase));
+}
+
+void window_watchdog_note_poll_latency(WindowState *state, gint64 latency_us) {
+    if (state == NULL || latency_us < WINDOW_WATCHDOG_STALL_US) {
+        return;
+    }
+    // A tagged stall that ended after the poll fell due already accounts for the lateness
+    if (state->watchdog.last_stall_end_us > g_get_monotonic_time() - latency_us) {
+        return;
+    }
+
+    window_watchdog_record(state, WINDOW_PHASE_OTHER, latency_us);
+    g_printerr(
+        "Watch poll ran %lld ms late; the main loop was blocked outside wpctl, config, css, and render work\n",
+        (long long)(latency_us / 1000)
+    );
+}
@@ -2,11 +2,15 @@
 
 #include "internal.h"
 
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
 #define OSD_MIN_IDLE_WATCH_POLL_MS 250U
 #define OSD_MAX_IDLE_WATCH_POLL_MS 1000U
 
 // Derives idle poll interval to keep hidden watch loops low cost
-static unsigned int window_compute_idle_watch_poll_ms(unsigned int active_poll_ms) {
+unsigned int window_compute_idle_watch_poll_ms(unsigned int active_poll_ms) {
   unsigned int idle_poll_ms = OSD_MAX_IDLE_WATCH_POLL_MS;
 
   if (active_poll_ms <= (OSD_MAX_IDLE_WATCH_POLL_MS / 3U)) {
@@ -39,18 +43,69 @@ void window_set_error(WindowState *state, const char *message) {
   }
 }
 
+// Removes one display scoped provider and drops its reference
+static void window_remove_css_provider(GtkCssProvider **provider) {
+  GdkDisplay *display = gdk_display_get_default();
+
+  if (*provider == NULL) {
+    return;
+  }
+
+  if (display != NULL) {
+    // Display scoped provider must be removed explicitly
+    gtk_style_context_remove_provider_for_display(display, GTK_STYLE_PROVIDER(*provider));
+  }
+  g_clear_object(provider);
+}
+
+// Drops every provider installed by window_init_css
+// keep_custom uninstalls the custom provider but keeps its reference, the fallback for a file broken while released
+static void window_release_css(WindowState *state, bool keep_custom) {
+  GdkDisplay *display = gdk_display_get_default();
+
+  window_remove_css_provider(&state->css_provider);
+  window_remove_css_provider(&state->theme_css_provider);
+  if (!keep_custom) {
+    window_remove_css_provider(&state->custom_css_provider);
+    return;
+  }
+  if (state->custom_css_provider != NULL && display != NULL) {
+    gtk_style_context_remove_provider_for_display(display, GTK_STYLE_PROVIDER(state->custom_css_provider));
+  }
+}
+
+// Destroying the toplevel frees the widget tree, render nodes, surface, and renderer
+void window_view_free(WindowView *view) {
+  gtk_window_destroy(GTK_WINDOW(view->window));
+  window_monitors_set_view_monitor(NULL, view, NULL);
+  g_free(view);
+}
+
+// Drops every view while keeping args, timers, and providers for a later rebuild
+static void window_views_destroy(WindowState *state) {
+  for (unsigned int index = 0U; index < state->view_count; index++) {
+    window_view_free(state->views[index]);
+    state->views[index] = NULL;
+  }
+  state->view_count = 0U;
+}
+
 // Releases timers CSS providers and held app references
 static void window_cleanup(WindowState *state) {
-  if (state->timeout_source_id != 0U) {
-    // Remove timeout source before shutdown returns
-    g_source_remove(state->timeout_source_id);
-    state->timeout_source_id = 0U;
-  }
+  // Remove timeout and watch sources before shutdown returns
+  window_cancel_timers(state);
+  window_config_reload_cleanup(state);
+  window_css_reload_cleanup(state);
+  window_monitors_cleanup(state);
+  window_hyprland_cleanup(state);
+  window_watchdog_stop(state);
+  window_views_destroy(state);
+  window_icons_clear(state);
 
-  if (state->watch_source_id != 0U) {
-    // Remove watch source before shutdown returns
-    g_source_remove(state->watch_source_id);
-    state->watch_source_id = 0U;
+  if (state->stats_signal_source_id != 0U) {
+    // Signal source is a real GLib source and bypasses timer seams
+    g_source_remove(state->stats_signal_source_id);
+    state->stats_signal_source_id = 0U;
   }
 
   if (state->app_held && g_application_get_default() != NULL) {
@@ -59,25 +114,7 @@ static void window_cleanup(WindowState *state) {
     state->app_held = false;
   }
 
-  if (state->css_provider != NULL && state->window != NULL) {
-    GdkDisplay *display = gtk_widget_get_display(state->window);
-    if (display != NULL) {
-      // Display scoped provider must be removed explicitly
-      gtk_style_context_remove_provider_for_display(display, GTK_STYLE_PROVIDER(state->css_provider));
-    }
-    g_object_unref(state->css_provider);
-    state->css_provider = NULL;
-  }
-
-  if (state->custom_css_provider != NULL && state->window != NULL) {
-    GdkDisplay *display = gtk_widget_get_display(state->window);
-    if (display != NULL) {
-      // Display scoped provider must be removed explicitly
-      gtk_style_context_remove_provider_for_display(display, GTK_STYLE_PROVIDER(state->custom_css_provider));
-    }
-    g_object_unref(state->custom_css_provider);
-    state->custom_css_provider = NULL;
-  }
+  window_release_css(state, false);
 }
 
 // GTK shutdown callback for guaranteed cleanup
@@ -88,17 +125,120 @@ static void window_on_shutdown(GApplication *app, gpointer user_data) {
   window_cleanup(state);
 }
 
-// Creates base GTK window and attaches static widget structure
-static void window_configure_base_window(WindowState *state, GtkApplication *app) {
-  state->window = gtk_application_window_new(app);
-  gtk_window_set_title(GTK_WINDOW(state->window), "HyprVolume");
-  gtk_window_set_decorated(GTK_WINDOW(state->window), FALSE);
-  gtk_window_set_resizable(GTK_WINDOW(state->window), FALSE);
+// Bundled icons are rasterized per scale, so a monitor scale change reloads them
+static void window_on_scale_factor_changed(GObject *object, GParamSpec *pspec, gpointer user_data) {
+  WindowState *state = user_data;
+
+  (void)object;
+  (void)pspec;
+  if (state->args.theme.system_icons) {
+    return;
+  }
+
+  window_icons_prepare(state);
+  for (unsigned int index = 0U; index < state->view_count; index++) {
+    state->views[index]->render_cache.valid = false;
+  }
+  window_update_widgets(state);
+}
 
-  gtk_widget_add_css_class(state->window, "osd-window");
+// Creates one GTK window pinned to monitor and attaches static widget structure
+WindowView *window_view_new(WindowState *state, GtkApplication *app, GdkMonitor *monitor) {
+  WindowView *view = g_new0(WindowView, 1);
+
+  window_monitors_set_view_monitor(state, view, monitor);
+  view->window = gtk_application_window_new(app);
+  gtk_window_set_title(GTK_WINDOW(view->window), "HyprVolume");
+  gtk_window_set_decorated(GTK_WINDOW(view->window), FALSE);
+  gtk_window_set_resizable(GTK_WINDOW(view->window), FALSE);
+
+  gtk_widget_add_css_class(view->window, "osd-window");
   // Placement runs before widget tree for namespace and anchors
-  window_apply_placement(state);
-  window_build_widgets(state);
+  window_apply_placement(state, view);
+  window_build_widgets(state, view);
+  g_signal_connect(view->window, "notify::scale-factor", G_CALLBACK(window_on_scale_factor_changed), state);
+  window_stats_track_frames(state, view);
+  window_surface_track_regions(view);
+  return view;
+}
+
+// Creates one view per selected monitor, all fed by the same sampler and styled by the same providers
+static void window_views_build(WindowState *state, GtkApplication *app) {
+  GdkMonitor *monitors[WINDOW_MAX_VIEWS] = {NULL};
+  const unsigned int count = window_resolve_monitors(state, monitors);
+
+  for (unsigned int index = 0U; index < count; index++) {
+    state->views[state->view_count] = window_view_new(state, app, monitors[index]);
+    state->view_count++;
+  }
+  // Icons are shared, so they load once after every view exists
+  window_icons_prepare(state);
+}
+
+void window_views_rebuild(WindowState *state) {
+  GApplication *app = g_application_get_default();
+
+  if (state == NULL || state->view_count == 0U || app == NULL) {
+    return;
+  }
+
+  window_views_destroy(state);
+  window_views_build(state, GTK_APPLICATION(app));
+  window_runtime_sync_views(state);
+}
+
+void window_release(WindowState *state) {
+  long long rss_before_kib = -1LL;
+
+  if (state == NULL || state->view_count == 0U) {
+    return;
+  }
+
+  rss_before_kib = osd_system_resource_sample_rss_kib();
+  window_icons_clear(state);
+  window_release_css(state, true);
+  window_views_destroy(state);
+  state->render_pending = true;
+#ifdef __GLIBC__
+  // Freed GTK and Pango allocations stay in malloc arenas until trimmed back to the kernel
+  (void)malloc_trim(0U);
+#endif
+
+  state->stats.window_releases++;
+  state->stats.release_rss_before_kib = rss_before_kib;
+  state->stats.release_rss_after_kib = osd_system_resource_sample_rss_kib();
+}
+
+bool window_restore(WindowState *state) {
+  GApplication *app = g_application_get_default();
+  gint64 started_us = 0;
+  gint64 elapsed_us = 0;
+
+  if (state == NULL) {
+    return false;
+  }
+  if (state->view_count > 0U) {
+    return true;
+  }
+  if (app == NULL) {
+    return false;
+  }
+
+  // Rebuild cost is real time even when the runtime clock seam is replaced
+  started_us = g_get_monotonic_time();
+  window_views_build(state, GTK_APPLICATION(app));
+  if (!window_init_css(state)) {
+    // Custom CSS may have broken while released, and a long running watcher outlives one bad edit
+    g_printerr("Failed to rebuild custom CSS styling; showing the popup with the built-in style\n");
+  }
+  elapsed_us = g_get_monotonic_time() - started_us;
+
+  state->stats.window_restores++;
+  state->stats.restore_total_us += elapsed_us;
+  if (elapsed_us > state->stats.restore_max_us) {
+    state->stats.restore_max_us = elapsed_us;
+  }
+  return true;
 }
 
 // Selects runtime activation path based on parsed args
@@ -121,18 +261,21 @@ static void window_activate_mode(WindowState *state, GtkApplication *app) {
 static void window_on_activate(GtkApplication *app, gpointer user_data) {
   WindowState *state = user_data;
 
-  window_configure_base_window(state, app);
+  window_views_build(state, app);
+  window_monitors_track(state);
+  window_hyprland_sync(state);
 
   if (!window_init_css(state)) {
     window_set_error(state, "Failed to initialize OSD CSS styling");
     return;
   }
 
+  window_stats_init(state);
   window_activate_mode(state, app);
 }
 
 // Main GUI entrypoint used by app main after args parse
-int osd_window_run(const OSDArgs *args) {
+int osd_window_run(const OSDArgs *args, OSDWindowReloadFn reload_fn, void *reload_data) {
   GtkApplication *app = NULL;
   WindowState state = {0};
   int status = 1;
@@ -149,6 +292,9 @@ int osd_window_run(const OSDArgs *args) {
   // Idle poll interval is derived once from active interval
   state.watch_idle_poll_ms = window_compute_idle_watch_poll_ms(args->watch_poll_ms);
   state.exit_code = 0;
+  state.hyprland_fd = -1;
+  state.reload_fn = reload_fn;
+  state.reload_data = reload_data;
 
   app = gtk_application_new("dev.hyprland.hyprvolume", G_APPLICATION_NON_UNIQUE);
   if (app == NULL) {
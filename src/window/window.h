@@ -3,7 +3,15 @@
 
 #include "args/args.h"
 
+#include <stdbool.h>
+#include <stdio.h>
+
+// Re-resolves final args from defaults, config file, and CLI overrides
+// Returns false and leaves out_args untouched when the new config is invalid
+typedef bool (*OSDWindowReloadFn)(OSDArgs *out_args, FILE *err_stream, void *user_data);
+
 // Starts the GTK window flow and returns process exit code
-int osd_window_run(const OSDArgs *args);
+// reload_fn may be null, which disables config hot reload in watch mode
+int osd_window_run(const OSDArgs *args, OSDWindowReloadFn reload_fn, void *reload_data);
 
 #endif
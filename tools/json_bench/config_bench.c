@@ -0,0 +1,186 @@
+// Load-time benchmark of osd_config_apply_file()
+// Times the shipped config, then a copy whitespace-padded to the 1 MiB loader limit, with the snapshot cache off so
+// every round reads, indexes, and applies the JSON; scripts/bench_json.sh prints the per-load cost of both
+
+#include "args/args.h"
+#include "config/config.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+// Matches the size cap in config/io.c, the largest file the loader accepts
+#define CONFIG_BENCH_PADDED_BYTES (1024U * 1024U)
+// Each config is loaded for at least this long, so the shipped one is not dominated by clock resolution
+#define CONFIG_BENCH_MIN_NS 500000000LL
+
+static long long config_bench_now_ns(void) {
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return (long long)now.tv_sec * 1000000000LL + (long long)now.tv_nsec;
+}
+
+static char *config_bench_read_file(const char *path, size_t *out_length) {
+    FILE *file = fopen(path, "rb");
+    char *text = NULL;
+    long size = 0L;
+
+    if (file == NULL) {
+        fprintf(stderr, "config bench: cannot open %s: %s\n", path, strerror(errno));
+        return NULL;
+    }
+    if (fseek(file, 0L, SEEK_END) != 0 || (size = ftell(file)) < 0L || fseek(file, 0L, SEEK_SET) != 0) {
+        fprintf(stderr, "config bench: cannot size %s\n", path);
+        (void)fclose(file);
+        return NULL;
+    }
+    text = malloc((size_t)size + 1U);
+    if (text == NULL || fread(text, 1U, (size_t)size, file) != (size_t)size) {
+        fprintf(stderr, "config bench: cannot read %s\n", path);
+        free(text);
+        (void)fclose(file);
+        return NULL;
+    }
+    text[size] = '\0';
+    (void)fclose(file);
+    *out_length = (size_t)size;
+    return text;
+}
+
+// Spreads spaces evenly after every newline, which JSON never allows inside a string, so the padded copy
+// parses to the same settings while every key sits behind a long run of whitespace
+static bool config_bench_write_padded(const char *text, size_t length, const char *padded_path) {
+    FILE *file = NULL;
+    size_t newlines = 0U;
+    size_t padding = 0U;
+    size_t written = 0U;
+
+    for (size_t index = 0U; index < length; index++) {
+        newlines += text[index] == '\n';
+    }
+    if (newlines == 0U || length >= CONFIG_BENCH_PADDED_BYTES) {
+        fprintf(stderr, "config bench: source config cannot be padded to %u bytes\n", CONFIG_BENCH_PADDED_BYTES);
+        return false;
+    }
+    padding = CONFIG_BENCH_PADDED_BYTES - length;
+
+    file = fopen(padded_path, "wb");
+    if (file == NULL) {
+        fprintf(stderr, "config bench: cannot write %s: %s\n", padded_path, strerror(errno));
+        return false;
+    }
+    for (size_t index = 0U, seen = 0U; index < length; index++) {
+        (void)fputc(text[index], file);
+        written++;
+        if (text[index] == '\n') {
+            // Remainder goes to the earliest newlines, so the total lands on the cap exactly
+            size_t run = padding / newlines + ((seen < padding % newlines) ? 1U : 0U);
+
+            seen++;
+            for (size_t space = 0U; space < run; space++) {
+                (void)fputc(' ', file);
+            }
+            written += run;
+        }
+    }
+    if (fclose(file) != 0 || written != CONFIG_BENCH_PADDED_BYTES) {
+        fprintf(stderr, "config bench: short write to %s\n", padded_path);
+        return false;
+    }
+    return true;
+}
+
+static bool config_bench_time(const char *label, const char *path, size_t length) {
+    unsigned long long rounds = 0ULL;
+    long long started_ns = config_bench_now_ns();
+    long long elapsed_ns = 0LL;
+
+    do {
+        OSDArgs args;
+
+        osd_args_defaults(&args);
+        if (!osd_config_apply_file(path, &args, stderr)) {
+            fprintf(stderr, "config bench: %s config failed to load\n", label);
+            return false;
+        }
+        rounds++;
+        elapsed_ns = config_bench_now_ns() - started_ns;
+    } while (elapsed_ns < CONFIG_BENCH_MIN_NS);
+
+    printf(
+        "hyprvolume config: config=%s bytes=%zu loads=%llu load_ms=%.3f\n",
+        label,
+        length,
+        rounds,
+        (double)elapsed_ns / 1e6 / (double)rounds
+    );
+    return true;
+}
+
+static void config_bench_print_usage(FILE *stream, const char *program) {
+    fprintf(
+        stream,
+        "Usage: %s [options]\n\n"
+        "  --config <path>          Config to time and pad (default: assets/default-config.json)\n",
+        program
+    );
+}
+
+int main(int argc, char **argv) {
+    const char *config_path = "assets/default-config.json";
+    char padded_path[] = "/tmp/hyprvolume-config-bench-XXXXXX";
+    char *text = NULL;
+    size_t length = 0U;
+    int padded_fd = -1;
+    bool ok = true;
+
+    for (int index = 1; index < argc; index++) {
+        const char *option = argv[index];
+        const char *option_value = (index + 1 < argc) ? argv[index + 1] : NULL;
+
+        if (strcmp(option, "-h") == 0 || strcmp(option, "--help") == 0) {
+            config_bench_print_usage(stdout, argv[0]);
+            return EXIT_SUCCESS;
+        }
+        if (strcmp(option, "--config") != 0) {
+            fprintf(stderr, "Unknown option: %s\n", option);
+            config_bench_print_usage(stderr, argv[0]);
+            return EXIT_FAILURE;
+        }
+        if (option_value == NULL) {
+            fprintf(stderr, "Invalid or missing value after %s\n", option);
+            return EXIT_FAILURE;
+        }
+        config_path = option_value;
+        index++;
+    }
+
+    // A snapshot hit would skip the parse this bench is here to time
+    if (setenv("HYPRVOLUME_NO_CONFIG_CACHE", "1", 1) != 0) {
+        return EXIT_FAILURE;
+    }
+
+    text = config_bench_read_file(config_path, &length);
+    if (text == NULL) {
+        return EXIT_FAILURE;
+    }
+    padded_fd = mkstemp(padded_path);
+    if (padded_fd < 0) {
+        fprintf(stderr, "config bench: cannot create a padded copy: %s\n", strerror(errno));
+        free(text);
+        return EXIT_FAILURE;
+    }
+    (void)close(padded_fd);
+
+    ok = config_bench_time("shipped", config_path, length);
+    ok = ok && config_bench_write_padded(text, length, padded_path);
+    ok = ok && config_bench_time("padded", padded_path, CONFIG_BENCH_PADDED_BYTES);
+
+    (void)unlink(padded_path);
+    free(text);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,347 @@
+// Throughput benchmark and fuzz check of the JSON structural scanner
+// Build once natively and once with -DOSD_JSON_SCAN_SCALAR_ONLY; scripts/bench_json.sh compares the fuzz digests of
+// both builds and prints MB/s for each, so a vector backend that drifts from the byte loop fails before it ships
+
+#include "config/json/json_struct_scan_internal.h"
+#include "config/json/json_token_scan_internal.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define JSON_BENCH_FUZZ_MAX_BYTES 4096U
+#define JSON_BENCH_FUZZ_MAX_CHUNK 300U
+#define JSON_BENCH_FUZZ_MAX_CAPACITY 200U
+// Offsets drained per feed in the throughput loop, enough that a vector backend never falls back to the tail path
+#define JSON_BENCH_SCAN_CAPACITY 4096U
+// Each corpus is timed for at least this long, so short runs are not dominated by clock resolution
+#define JSON_BENCH_MIN_NS 500000000LL
+#define JSON_BENCH_FNV64_OFFSET_BASIS 14695981039346656037ULL
+#define JSON_BENCH_FNV64_PRIME 1099511628211ULL
+
+typedef struct {
+    uint64_t rng;
+    // FNV-1a over every offset and final string state, identical across backends when they agree
+    uint64_t digest;
+} JsonBench;
+
+// xorshift64, seeded from the command line so a failing case can be replayed exactly
+static uint64_t json_bench_random(JsonBench *bench) {
+    bench->rng ^= bench->rng << 13U;
+    bench->rng ^= bench->rng >> 7U;
+    bench->rng ^= bench->rng << 17U;
+    return bench->rng;
+}
+
+static size_t json_bench_random_below(JsonBench *bench, size_t bound) {
+    return (size_t)(json_bench_random(bench) % (uint64_t)bound);
+}
+
+static void json_bench_digest(JsonBench *bench, uint64_t value) {
+    for (unsigned int shift = 0U; shift < 64U; shift += 8U) {
+        bench->digest ^= (value >> shift) & 0xffU;
+        bench->digest *= JSON_BENCH_FNV64_PRIME;
+    }
+}
+
+static long long json_bench_now_ns(void) {
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return (long long)now.tv_sec * 1000000000LL + (long long)now.tv_nsec;
+}
+
+// Reference byte loop written from the scanner's contract, unescaped quotes plus structurals outside strings
+static size_t json_bench_reference_scan(const char *text, size_t length, size_t *out_offsets, bool *out_in_string) {
+    bool escaped = false;
+    bool in_string = false;
+    size_t count = 0U;
+
+    for (size_t index = 0U; index < length; index++) {
+        const char byte = text[index];
+        const bool was_escaped = escaped;
+
+        // A backslash escapes the next byte, which only matters when that byte is a quote
+        escaped = byte == '\\' && !was_escaped;
+        if (byte == '"' && !was_escaped) {
+            in_string = !in_string;
+            out_offsets[count] = index;
+            count++;
+            continue;
+        }
+        if (!in_string && strchr("{}[]:,", byte) != NULL && byte != '\0') {
+            out_offsets[count] = index;
+            count++;
+        }
+    }
+    *out_in_string = in_string;
+    return count;
+}
+
+// Bytes weighted toward structurals, quotes, and backslash runs, the cases where carries cross block edges
+static void json_bench_fill_fuzz_text(JsonBench *bench, char *text, size_t length) {
+    static const char alphabet[] = "{}[]:,\"\"\"\\\\\\ a0.\n";
+
+    for (size_t index = 0U; index < length; index++) {
+        text[index] = alphabet[json_bench_random_below(bench, sizeof(alphabet) - 1U)];
+    }
+}
+
+// Feeds one text in random chunks with random output capacities and checks every offset against the reference
+static bool json_bench_fuzz_case(JsonBench *bench, unsigned long long case_index) {
+    char text[JSON_BENCH_FUZZ_MAX_BYTES];
+    size_t expected[JSON_BENCH_FUZZ_MAX_BYTES];
+    size_t actual[JSON_BENCH_FUZZ_MAX_BYTES];
+    const size_t length = 1U + json_bench_random_below(bench, JSON_BENCH_FUZZ_MAX_BYTES);
+    OSDJsonScanner scanner;
+    bool expected_in_string = false;
+    size_t expected_count = 0U;
+    size_t actual_count = 0U;
+    size_t fed = 0U;
+
+    json_bench_fill_fuzz_text(bench, text, length);
+    expected_count = json_bench_reference_scan(text, length, expected, &expected_in_string);
+
+    osd_json_scanner_init(&scanner);
+    while (fed < length) {
+        const size_t chunk = 1U + json_bench_random_below(bench, JSON_BENCH_FUZZ_MAX_CHUNK);
+        const size_t chunk_length = (chunk < length - fed) ? chunk : length - fed;
+        size_t chunk_fed = 0U;
+
+        while (chunk_fed < chunk_length) {
+            size_t batch[JSON_BENCH_FUZZ_MAX_CAPACITY];
+            const size_t capacity = 1U + json_bench_random_below(bench, JSON_BENCH_FUZZ_MAX_CAPACITY);
+            size_t batch_count = 0U;
+
+            chunk_fed += osd_json_scanner_feed(
+                &scanner,
+                text + fed + chunk_fed,
+                chunk_length - chunk_fed,
+                batch,
+                capacity,
+                &batch_count
+            );
+            if (actual_count + batch_count > JSON_BENCH_FUZZ_MAX_BYTES) {
+                fprintf(stderr, "json fuzz case %llu: scanner emitted more offsets than bytes\n", case_index);
+                return false;
+            }
+            memcpy(actual + actual_count, batch, batch_count * sizeof(batch[0]));
+            actual_count += batch_count;
+        }
+        fed += chunk_length;
+    }
+
+    if (actual_count != expected_count || memcmp(actual, expected, expected_count * sizeof(expected[0])) != 0 ||
+        osd_json_scanner_in_string(&scanner) != expected_in_string) {
+        fprintf(
+            stderr,
+            "json fuzz case %llu: %s backend emitted %zu offsets, reference %zu, in_string %d vs %d\n",
+            case_index,
+            osd_json_scanner_backend_name(),
+            actual_count,
+            expected_count,
+            (int)osd_json_scanner_in_string(&scanner),
+            (int)expected_in_string
+        );
+        return false;
+    }
+
+    for (size_t index = 0U; index < actual_count; index++) {
+        json_bench_digest(bench, (uint64_t)actual[index]);
+    }
+    json_bench_digest(bench, expected_in_string ? 1U : 0U);
+    return true;
+}
+
+// Array of long CSS strings with escaped quotes, where whole blocks sit inside strings
+static size_t json_bench_build_strings(JsonBench *bench, char *text, size_t size) {
+    static const char *const words[] = {
+        "linear-gradient(180deg, rgba(26, 37, 58, 0.98), rgba(20, 30, 46, 0.98))",
+        "rgba(95, 123, 169, 0.48)",
+        "font-family: \\\"Inter\\\", sans-serif",
+        "0 6px 18px rgba(7, 12, 22, 0.62)",
+    };
+    size_t used = 0U;
+
+    text[used++] = '[';
+    while (used + 256U < size) {
+        const char *word = words[json_bench_random_below(bench, sizeof(words) / sizeof(words[0]))];
+
+        used += (size_t)snprintf(text + used, size - used, "%s\"%s %s\"", (used > 1U) ? "," : "", word, word);
+    }
+    text[used++] = ']';
+    text[used] = '\0';
+    return used;
+}
+
+// Nested arrays of short numbers, where structurals are dense and every block emits many offsets
+static size_t json_bench_build_numbers(JsonBench *bench, char *text, size_t size) {
+    size_t used = 0U;
+
+    text[used++] = '[';
+    while (used + 64U < size) {
+        used += (size_t)snprintf(
+            text + used,
+            size - used,
+            "%s[%u,%u.%u,[%u]]",
+            (used > 1U) ? "," : "",
+            (unsigned int)json_bench_random_below(bench, 1000U),
+            (unsigned int)json_bench_random_below(bench, 100U),
+            (unsigned int)json_bench_random_below(bench, 10U),
+            (unsigned int)json_bench_random_below(bench, 200U)
+        );
+    }
+    text[used++] = ']';
+    text[used] = '\0';
+    return used;
+}
+
+static double json_bench_mb_per_s(size_t length, unsigned long long rounds, long long elapsed_ns) {
+    return (double)length * (double)rounds / 1e6 / ((double)elapsed_ns / 1e9);
+}
+
+// Times the raw scanner and the container skip the config loader uses over one corpus
+static bool json_bench_throughput(const char *corpus_name, const char *text, size_t length) {
+    static size_t offsets[JSON_BENCH_SCAN_CAPACITY];
+    unsigned long long rounds = 0ULL;
+    long long started_ns = json_bench_now_ns();
+    long long elapsed_ns = 0LL;
+    double scan_mb_s = 0.0;
+    double skip_mb_s = 0.0;
+
+    do {
+        OSDJsonScanner scanner;
+        size_t fed = 0U;
+
+        osd_json_scanner_init(&scanner);
+        while (fed < length) {
+            size_t count = 0U;
+
+            fed += osd_json_scanner_feed(&scanner, text + fed, length - fed, offsets, JSON_BENCH_SCAN_CAPACITY, &count);
+        }
+        rounds++;
+        elapsed_ns = json_bench_now_ns() - started_ns;
+    } while (elapsed_ns < JSON_BENCH_MIN_NS);
+    scan_mb_s = json_bench_mb_per_s(length, rounds, elapsed_ns);
+
+    rounds = 0ULL;
+    started_ns = json_bench_now_ns();
+    do {
+        if (osd_json_skip_container_token(text) != text + length) {
+            fprintf(stderr, "json bench: container skip stopped early on the %s corpus\n", corpus_name);
+            return false;
+        }
+        rounds++;
+        elapsed_ns = json_bench_now_ns() - started_ns;
+    } while (elapsed_ns < JSON_BENCH_MIN_NS);
+    skip_mb_s = json_bench_mb_per_s(length, rounds, elapsed_ns);
+
+    printf(
+        "hyprvolume json: backend=%s corpus=%s bytes=%zu scan_mb_s=%.0f skip_mb_s=%.0f\n",
+        osd_json_scanner_backend_name(),
+        corpus_name,
+        length,
+        scan_mb_s,
+        skip_mb_s
+    );
+    return true;
+}
+
+static bool json_bench_parse_uint(const char *text, unsigned long long max_value, unsigned long long *out_value) {
+    char *end = NULL;
+    unsigned long long value = 0ULL;
+
+    if (text == NULL || text[0] < '0' || text[0] > '9') {
+        return false;
+    }
+    errno = 0;
+    value = strtoull(text, &end, 10);
+    if (errno != 0 || end == text || *end != '\0' || value > max_value) {
+        return false;
+    }
+    *out_value = value;
+    return true;
+}
+
+static void json_bench_print_usage(FILE *stream, const char *program) {
+    fprintf(
+        stream,
+        "Usage: %s [options]\n\n"
+        "  --fuzz-cases <count>     Random texts checked against the reference loop (default: 20000)\n"
+        "  --megabytes <count>      Size of each throughput corpus (default: 2)\n"
+        "  --seed <value>           Fuzz and corpus seed (default: 1)\n",
+        program
+    );
+}
+
+int main(int argc, char **argv) {
+    JsonBench bench;
+    unsigned long long fuzz_cases = 20000ULL;
+    unsigned long long megabytes = 2ULL;
+    unsigned long long seed = 1ULL;
+    char *text = NULL;
+    size_t size = 0U;
+    size_t length = 0U;
+    bool ok = true;
+
+    for (int index = 1; index < argc; index++) {
+        const char *option = argv[index];
+        const char *option_value = (index + 1 < argc) ? argv[index + 1] : NULL;
+        bool parsed = option_value != NULL;
+
+        if (strcmp(option, "-h") == 0 || strcmp(option, "--help") == 0) {
+            json_bench_print_usage(stdout, argv[0]);
+            return EXIT_SUCCESS;
+        }
+        if (strcmp(option, "--fuzz-cases") == 0) {
+            parsed = parsed && json_bench_parse_uint(option_value, 100000000ULL, &fuzz_cases);
+        } else if (strcmp(option, "--megabytes") == 0) {
+            parsed = parsed && json_bench_parse_uint(option_value, 1024ULL, &megabytes) && megabytes > 0ULL;
+        } else if (strcmp(option, "--seed") == 0) {
+            parsed = parsed && json_bench_parse_uint(option_value, ULLONG_MAX, &seed);
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", option);
+            json_bench_print_usage(stderr, argv[0]);
+            return EXIT_FAILURE;
+        }
+        if (!parsed) {
+            fprintf(stderr, "Invalid or missing value after %s\n", option);
+            return EXIT_FAILURE;
+        }
+        index++;
+    }
+
+    // Zero would stick xorshift at zero forever
+    bench.rng = (seed == 0ULL) ? 0x9e3779b97f4a7c15ULL : (uint64_t)seed;
+    bench.digest = JSON_BENCH_FNV64_OFFSET_BASIS;
+    for (unsigned long long case_index = 0ULL; case_index < fuzz_cases; case_index++) {
+        if (!json_bench_fuzz_case(&bench, case_index)) {
+            return EXIT_FAILURE;
+        }
+    }
+    printf(
+        "hyprvolume json: backend=%s fuzz_cases=%llu fuzz_digest=%016llx\n",
+        osd_json_scanner_backend_name(),
+        fuzz_cases,
+        (unsigned long long)bench.digest
+    );
+
+    size = (size_t)megabytes * 1024U * 1024U;
+    text = malloc(size + 1U);
+    if (text == NULL) {
+        fprintf(stderr, "json bench: cannot allocate a %llu MiB corpus\n", megabytes);
+        return EXIT_FAILURE;
+    }
+    length = json_bench_build_strings(&bench, text, size);
+    ok = json_bench_throughput("strings", text, length);
+    if (ok) {
+        length = json_bench_build_numbers(&bench, text, size);
+        ok = json_bench_throughput("numbers", text, length);
+    }
+    free(text);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,10 @@
+// Build-time check of the schema's pinned perfect-hash seeds
+// A schema edit that makes a seed collide fails make check here instead of sending every process into a seed search
+
+#include "args/schema.h"
+
+#include <stdlib.h>
+
+int main(void) {
+    return osd_schema_check_hash_seeds(stderr) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,375 @@
+// Soak simulation of the watch runtime on a virtual clock
+// Timers, the clock, and the volume query go through the runtime seams, so days of polls, bursts, and wpctl
+// outages run in seconds while GTK still maps, paints, and tears down real windows between timer batches
+
+#include "args/args.h"
+#include "window/internal.h"
+#include "window/window.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SOAK_TIMER_MAX 64U
+// Virtual timers fired per main loop turn before GTK gets to lay out and paint again
+#define SOAK_TIMERS_PER_TURN 512U
+#define SOAK_US_PER_SECOND 1000000LL
+#define SOAK_US_PER_HOUR (3600LL * SOAK_US_PER_SECOND)
+// Key repeat of a held volume key
+#define SOAK_KEY_REPEAT_US 33333LL
+
+typedef struct {
+    guint id;
+    gint64 due_us;
+    guint interval_ms;
+    GSourceFunc callback;
+    gpointer user_data;
+} SoakTimer;
+
+typedef enum {
+    SOAK_MODEL_IDLE = 0,
+    // Volume key held, one step per key repeat
+    SOAK_MODEL_BURST,
+    // wpctl fails until the phase ends, as when PipeWire restarts
+    SOAK_MODEL_OUTAGE
+} SoakModelPhase;
+
+// Deterministic user and audio server behaviour, advanced lazily to the virtual time of each query
+typedef struct {
+    guint64 rng;
+    SoakModelPhase phase;
+    gint64 phase_end_us;
+    gint64 next_event_us;
+    gint64 next_step_us;
+    int step_percent;
+    OSDVolumeState volume;
+    guint64 bursts;
+    guint64 mute_toggles;
+    guint64 outages;
+    guint64 queries;
+    guint64 failed_queries;
+} SoakModel;
+
+typedef struct {
+    SoakTimer timers[SOAK_TIMER_MAX];
+    unsigned int timer_count;
+    guint next_timer_id;
+    gint64 now_us;
+    gint64 end_us;
+    gint64 report_interval_us;
+    gint64 next_report_us;
+    SoakModel model;
+    bool finished;
+} Soak;
+
+static Soak g_soak;
+
+static gint64 soak_clock(void) {
+    return g_soak.now_us;
+}
+
+static guint soak_timeout_add(guint interval_ms, GSourceFunc callback, gpointer user_data) {
+    SoakTimer *timer = NULL;
+
+    if (g_soak.timer_count >= SOAK_TIMER_MAX) {
+        // The runtime treats zero as a failed timer and reports it
+        return 0U;
+    }
+
+    timer = &g_soak.timers[g_soak.timer_count];
+    g_soak.timer_count++;
+    timer->id = g_soak.next_timer_id;
+    g_soak.next_timer_id++;
+    timer->due_us = g_soak.now_us + (gint64)interval_ms * 1000;
+    timer->interval_ms = interval_ms;
+    timer->callback = callback;
+    timer->user_data = user_data;
+    return timer->id;
+}
+
+static gboolean soak_source_remove(guint source_id) {
+    for (unsigned int index = 0U; index < g_soak.timer_count; index++) {
+        if (g_soak.timers[index].id == source_id) {
+            g_soak.timer_count--;
+            g_soak.timers[index] = g_soak.timers[g_soak.timer_count];
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+// xorshift64, seeded from the command line so a leak found once can be replayed exactly
+static guint64 soak_random(SoakModel *model) {
+    model->rng ^= model->rng << 13U;
+    model->rng ^= model->rng >> 7U;
+    model->rng ^= model->rng << 17U;
+    return model->rng;
+}
+
+static gint64 soak_random_range_us(SoakModel *model, gint64 min_us, gint64 max_us) {
+    return min_us + (gint64)(soak_random(model) % (guint64)(max_us - min_us + 1));
+}
+
+// Quiet stretches between events run from half a minute to twenty minutes
+static void soak_model_schedule(SoakModel *model, gint64 from_us) {
+    model->phase = SOAK_MODEL_IDLE;
+    model->next_event_us =
+        from_us + soak_random_range_us(model, 30LL * SOAK_US_PER_SECOND, 1200LL * SOAK_US_PER_SECOND);
+}
+
+static void soak_model_start_event(SoakModel *model) {
+    const guint64 roll = soak_random(model) % 100U;
+    const gint64 start_us = model->next_event_us;
+
+    if (roll < 70U) {
+        model->phase = SOAK_MODEL_BURST;
+        model->phase_end_us = start_us + soak_random_range_us(model, 100000LL, 3LL * SOAK_US_PER_SECOND);
+        model->next_step_us = start_us;
+        model->step_percent = (soak_random(model) % 2U == 0U) ? 5 : -5;
+        model->bursts++;
+        return;
+    }
+    if (roll < 80U) {
+        model->volume.muted = !model->volume.muted;
+        model->mute_toggles++;
+        soak_model_schedule(model, start_us);
+        return;
+    }
+
+    model->phase = SOAK_MODEL_OUTAGE;
+    model->phase_end_us = start_us + soak_random_range_us(model, 2LL * SOAK_US_PER_SECOND, 90LL * SOAK_US_PER_SECOND);
+    model->outages++;
+}
+
+// Replays every event due by now_us in order, so the volume seen depends only on the seed and the query time
+static void soak_model_advance(SoakModel *model, gint64 now_us) {
+    for (;;) {
+        if (model->phase == SOAK_MODEL_IDLE) {
+            if (now_us < model->next_event_us) {
+                return;
+            }
+            soak_model_start_event(model);
+            continue;
+        }
+        if (model->phase == SOAK_MODEL_BURST) {
+            while (model->next_step_us <= now_us && model->next_step_us <= model->phase_end_us) {
+                model->volume.volume_percent += model->step_percent;
+                if (model->volume.volume_percent < 0) {
+                    model->volume.volume_percent = 0;
+                }
+                if (model->volume.volume_percent > 150) {
+                    model->volume.volume_percent = 150;
+                }
+                model->next_step_us += SOAK_KEY_REPEAT_US;
+            }
+        }
+        if (now_us < model->phase_end_us) {
+            return;
+        }
+        soak_model_schedule(model, model->phase_end_us);
+    }
+}
+
+static bool soak_volume_query(OSDVolumeState *out_state, FILE *err_stream) {
+    SoakModel *model = &g_soak.model;
+
+    (void)err_stream;
+    soak_model_advance(model, g_soak.now_us);
+    model->queries++;
+    if (model->phase == SOAK_MODEL_OUTAGE) {
+        model->failed_queries++;
+        return false;
+    }
+    *out_state = model->volume;
+    return true;
+}
+
+static void soak_write_summary(void) {
+    const SoakModel *model = &g_soak.model;
+
+    fprintf(
+        stderr,
+        "hyprvolume soak: simulated_hours=%lld bursts=%llu mute_toggles=%llu outages=%llu queries=%llu "
+        "failed_queries=%llu\n",
+        (long long)(g_soak.now_us / SOAK_US_PER_HOUR),
+        (unsigned long long)model->bursts,
+        (unsigned long long)model->mute_toggles,
+        (unsigned long long)model->outages,
+        (unsigned long long)model->queries,
+        (unsigned long long)model->failed_queries
+    );
+}
+
+static gboolean soak_on_quit(gpointer user_data) {
+    (void)user_data;
+    if (g_application_get_default() != NULL) {
+        g_application_quit(g_application_get_default());
+    }
+    return G_SOURCE_REMOVE;
+}
+
+// Stats are dumped by the runtime's own SIGUSR1 handler, the same line a live watcher prints
+static void soak_report(void) {
+    (void)fflush(stderr);
+    (void)raise(SIGUSR1);
+}
+
+// Fires due virtual timers in order, then yields so signal sources, frames, and unmaps run
+static gboolean soak_on_pump(gpointer user_data) {
+    (void)user_data;
+
+    if (g_soak.finished) {
+        return G_SOURCE_REMOVE;
+    }
+    if (g_soak.timer_count == 0U) {
+        // Watch activation arms the first poll, and a failed one quits the application
+        return G_SOURCE_CONTINUE;
+    }
+
+    for (unsigned int fired = 0U; fired < SOAK_TIMERS_PER_TURN; fired++) {
+        SoakTimer timer;
+        unsigned int earliest = 0U;
+
+        for (unsigned int index = 1U; index < g_soak.timer_count; index++) {
+            if (g_soak.timers[index].due_us < g_soak.timers[earliest].due_us) {
+                earliest = index;
+            }
+        }
+        timer = g_soak.timers[earliest];
+
+        if (timer.due_us >= g_soak.next_report_us || timer.due_us >= g_soak.end_us) {
+            g_soak.now_us = (g_soak.next_report_us < g_soak.end_us) ? g_soak.next_report_us : g_soak.end_us;
+            soak_report();
+            if (g_soak.now_us >= g_soak.end_us) {
+                soak_write_summary();
+                g_soak.finished = true;
+                // Real delay lets the signal source print the final line before the loop stops
+                (void)g_timeout_add(200U, soak_on_quit, NULL);
+                return G_SOURCE_REMOVE;
+            }
+            g_soak.next_report_us += g_soak.report_interval_us;
+            return G_SOURCE_CONTINUE;
+        }
+
+        // Removed before the call, so the callback may re-arm or cancel any timer including itself
+        (void)soak_source_remove(timer.id);
+        if (timer.due_us > g_soak.now_us) {
+            g_soak.now_us = timer.due_us;
+        }
+        if (timer.callback(timer.user_data) == G_SOURCE_CONTINUE && g_soak.timer_count < SOAK_TIMER_MAX) {
+            // GLib keeps the id of a repeating source, so the seam does too
+            g_soak.timers[g_soak.timer_count] = timer;
+            g_soak.timers[g_soak.timer_count].due_us = g_soak.now_us + (gint64)timer.interval_ms * 1000;
+            g_soak.timer_count++;
+        }
+        if (g_soak.timer_count == 0U) {
+            return G_SOURCE_CONTINUE;
+        }
+    }
+    return G_SOURCE_CONTINUE;
+}
+
+static bool soak_parse_uint(const char *text, unsigned long long max_value, unsigned long long *out_value) {
+    char *end = NULL;
+    unsigned long long value = 0ULL;
+
+    if (text == NULL || text[0] < '0' || text[0] > '9') {
+        return false;
+    }
+    errno = 0;
+    value = strtoull(text, &end, 10);
+    if (errno != 0 || end == text || *end != '\0' || value > max_value) {
+        return false;
+    }
+    *out_value = value;
+    return true;
+}
+
+static void soak_print_usage(FILE *stream, const char *program) {
+    fprintf(
+        stream,
+        "Usage: %s [options]\n\n"
+        "  --days <count>           Simulated uptime (default: 7)\n"
+        "  --report-hours <count>   Simulated hours between stats lines (default: 24)\n"
+        "  --seed <value>           Event model seed (default: 1)\n"
+        "  --hide-mode <mode>       unmap, keep-mapped, or release (default: unmap)\n"
+        "  --watch-poll-ms <ms>     Active poll interval (default: hyprvolume's)\n"
+        "  --timeout-ms <ms>        Popup timeout (default: hyprvolume's)\n",
+        program
+    );
+}
+
+int main(int argc, char **argv) {
+    OSDArgs args;
+    unsigned long long days = 7ULL;
+    unsigned long long report_hours = 24ULL;
+    unsigned long long seed = 1ULL;
+    unsigned long long value = 0ULL;
+
+    osd_args_defaults(&args);
+    // Watch mode over the system volume is the long running path the soak exists for
+    args.watch_mode = true;
+    args.use_system_volume = true;
+
+    for (int index = 1; index < argc; index++) {
+        const char *option = argv[index];
+        const char *option_value = (index + 1 < argc) ? argv[index + 1] : NULL;
+        bool ok = option_value != NULL;
+
+        if (strcmp(option, "-h") == 0 || strcmp(option, "--help") == 0) {
+            soak_print_usage(stdout, argv[0]);
+            return EXIT_SUCCESS;
+        }
+        if (strcmp(option, "--days") == 0) {
+            ok = ok && soak_parse_uint(option_value, 3650ULL, &days) && days > 0ULL;
+        } else if (strcmp(option, "--report-hours") == 0) {
+            ok = ok && soak_parse_uint(option_value, 87600ULL, &report_hours) && report_hours > 0ULL;
+        } else if (strcmp(option, "--seed") == 0) {
+            ok = ok && soak_parse_uint(option_value, ULLONG_MAX, &seed);
+        } else if (strcmp(option, "--hide-mode") == 0) {
+            if (ok && strcmp(option_value, "unmap") == 0) {
+                args.hide_mode = OSD_HIDE_MODE_UNMAP;
+            } else if (ok && strcmp(option_value, "keep-mapped") == 0) {
+                args.hide_mode = OSD_HIDE_MODE_KEEP_MAPPED;
+            } else if (ok && strcmp(option_value, "release") == 0) {
+                args.hide_mode = OSD_HIDE_MODE_RELEASE;
+            } else {
+                ok = false;
+            }
+        } else if (strcmp(option, "--watch-poll-ms") == 0) {
+            ok = ok && soak_parse_uint(option_value, 2000ULL, &value) && value >= 40ULL;
+            args.watch_poll_ms = ok ? (unsigned int)value : args.watch_poll_ms;
+        } else if (strcmp(option, "--timeout-ms") == 0) {
+            ok = ok && soak_parse_uint(option_value, 10000ULL, &value) && value >= 100ULL;
+            args.timeout_ms = ok ? (unsigned int)value : args.timeout_ms;
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", option);
+            soak_print_usage(stderr, argv[0]);
+            return EXIT_FAILURE;
+        }
+        if (!ok) {
+            fprintf(stderr, "Invalid or missing value after %s\n", option);
+            return EXIT_FAILURE;
+        }
+        index++;
+    }
+
+    // Zero would stick xorshift at zero forever
+    g_soak.model.rng = (seed == 0ULL) ? 0x9e3779b97f4a7c15ULL : (guint64)seed;
+    g_soak.model.volume.volume_percent = 40;
+    g_soak.next_timer_id = 1U;
+    g_soak.now_us = 0;
+    g_soak.end_us = (gint64)days * 24LL * SOAK_US_PER_HOUR;
+    g_soak.report_interval_us = (gint64)report_hours * SOAK_US_PER_HOUR;
+    g_soak.next_report_us = g_soak.report_interval_us;
+    soak_model_schedule(&g_soak.model, 0);
+
+    window_runtime_set_clock_fn(soak_clock);
+    window_runtime_set_volume_query_fn(soak_volume_query);
+    window_runtime_set_timer_fns(soak_timeout_add, soak_source_remove);
+    (void)g_idle_add(soak_on_pump, NULL);
+
+    return osd_window_run(&args, NULL, NULL);
+}
@@ -0,0 +1,146 @@
+// Geometry sweep of the watch runtime
+// The volume query seam walks every value the popup can show, 0% to 200%, MUTED, and back to 0%, one per
+// watch poll in real time, so GTK lays out and paints each one before the runtime's stats line is printed
+
+#include "args/args.h"
+#include "window/internal.h"
+#include "window/window.h"
+
+#include <errno.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SWEEP_MAX_PERCENT 200
+// Real time for the last value to paint before the stats line, then for that line before the loop stops
+#define SWEEP_SETTLE_MS 500U
+#define SWEEP_QUIT_MS 200U
+
+typedef struct {
+    // Index into the sweep, past the end once the final value was handed out
+    int step;
+    guint64 queries;
+    bool finished;
+} Sweep;
+
+static Sweep g_sweep;
+
+// Steps 0 to 200 raise the volume, the next one mutes at 200%, and the last unmutes at 0%
+static void sweep_state_for_step(int step, OSDVolumeState *out_state) {
+    out_state->volume_percent = (step <= SWEEP_MAX_PERCENT) ? step : SWEEP_MAX_PERCENT;
+    out_state->muted = step == SWEEP_MAX_PERCENT + 1;
+    if (step >= SWEEP_MAX_PERCENT + 2) {
+        out_state->volume_percent = 0;
+    }
+}
+
+static gboolean sweep_on_quit(gpointer user_data) {
+    (void)user_data;
+    if (g_application_get_default() != NULL) {
+        g_application_quit(g_application_get_default());
+    }
+    return G_SOURCE_REMOVE;
+}
+
+// Stats are dumped by the runtime's own SIGUSR1 handler, the same line a live watcher prints
+static gboolean sweep_on_settled(gpointer user_data) {
+    (void)user_data;
+    fprintf(
+        stderr,
+        "hyprvolume sweep: steps=%d queries=%llu\n",
+        SWEEP_MAX_PERCENT + 3,
+        (unsigned long long)g_sweep.queries
+    );
+    (void)fflush(stderr);
+    (void)raise(SIGUSR1);
+    (void)g_timeout_add(SWEEP_QUIT_MS, sweep_on_quit, NULL);
+    return G_SOURCE_REMOVE;
+}
+
+static bool sweep_volume_query(OSDVolumeState *out_state, FILE *err_stream) {
+    (void)err_stream;
+    g_sweep.queries++;
+    sweep_state_for_step(g_sweep.step, out_state);
+    if (g_sweep.step < SWEEP_MAX_PERCENT + 2) {
+        g_sweep.step++;
+        return true;
+    }
+    if (!g_sweep.finished) {
+        g_sweep.finished = true;
+        (void)g_timeout_add(SWEEP_SETTLE_MS, sweep_on_settled, NULL);
+    }
+    return true;
+}
+
+static bool sweep_parse_uint(const char *text, unsigned long long max_value, unsigned long long *out_value) {
+    char *end = NULL;
+    unsigned long long value = 0ULL;
+
+    if (text == NULL || text[0] < '0' || text[0] > '9') {
+        return false;
+    }
+    errno = 0;
+    value = strtoull(text, &end, 10);
+    if (errno != 0 || end == text || *end != '\0' || value > max_value) {
+        return false;
+    }
+    *out_value = value;
+    return true;
+}
+
+static void sweep_print_usage(FILE *stream, const char *program) {
+    fprintf(
+        stream,
+        "Usage: %s [options]\n\n"
+        "  --watch-poll-ms <ms>     Time each value stays up (default: 40)\n"
+        "  --css <path>             Custom stylesheet, which swaps in the CSS drawn widgets\n",
+        program
+    );
+}
+
+int main(int argc, char **argv) {
+    OSDArgs args;
+    unsigned long long value = 0ULL;
+
+    osd_args_defaults(&args);
+    // Watch mode keeps one popup up across the sweep, since every poll sees a new value
+    args.watch_mode = true;
+    args.use_system_volume = true;
+    args.watch_poll_ms = 40U;
+
+    for (int index = 1; index < argc; index++) {
+        const char *option = argv[index];
+        const char *option_value = (index + 1 < argc) ? argv[index + 1] : NULL;
+        bool ok = option_value != NULL;
+
+        if (strcmp(option, "-h") == 0 || strcmp(option, "--help") == 0) {
+            sweep_print_usage(stdout, argv[0]);
+            return EXIT_SUCCESS;
+        }
+        if (strcmp(option, "--watch-poll-ms") == 0) {
+            ok = ok && sweep_parse_uint(option_value, 2000ULL, &value) && value >= 40ULL;
+            args.watch_poll_ms = ok ? (unsigned int)value : args.watch_poll_ms;
+        } else if (strcmp(option, "--css") == 0) {
+            ok = ok && strlen(option_value) < sizeof(args.css_path);
+            if (ok) {
+                memcpy(args.css_path, option_value, strlen(option_value) + 1U);
+                args.css_path_set = true;
+            }
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", option);
+            sweep_print_usage(stderr, argv[0]);
+            return EXIT_FAILURE;
+        }
+        if (!ok) {
+            fprintf(stderr, "Invalid or missing value after %s\n", option);
+            return EXIT_FAILURE;
+        }
+        index++;
+    }
+
+    // Outlasts the sweep's gaps between polls, so the popup never hides and shows again mid run
+    args.timeout_ms = 10000U;
+    window_runtime_set_volume_query_fn(sweep_volume_query);
+
+    return osd_window_run(&args, NULL, NULL);
+}